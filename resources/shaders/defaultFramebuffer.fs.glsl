@@ -6,8 +6,12 @@ out vec4 fragColor;
 
 uniform sampler2D gameObjectsTexture;
 uniform sampler2D lightingTexture;
+uniform float resolutionScale;
 
 void main()
 {
-    fragColor = texture(gameObjectsTexture, texCoords) * texture(lightingTexture, texCoords);
+    // don't let linear filtering sample texels outside of rendered part of framebuffers
+    vec2 halfTexel = 0.5 / vec2(textureSize(gameObjectsTexture, 0));
+    vec2 coords = min(texCoords, vec2(resolutionScale) - halfTexel);
+    fragColor = texture(gameObjectsTexture, coords) * texture(lightingTexture, coords);
 }
@@ -5,8 +5,11 @@ layout (location = 1) in vec2 aTexCoords;
 
 out vec2 texCoords;
 
+// only this part of framebuffer texture was rendered to
+uniform float resolutionScale;
+
 void main()
 {
-    texCoords = aTexCoords;
+    texCoords = aTexCoords * resolutionScale;
     gl_Position = vec4(aPos.x, aPos.y, 0, 1);
 }
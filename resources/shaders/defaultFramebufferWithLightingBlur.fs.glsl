@@ -0,0 +1,47 @@
+#version 330 core 
+
+in vec2 texCoords;
+
+out vec4 fragColor;
+
+uniform sampler2D gameObjectsTexture;
+uniform sampler2D lightingTexture;
+uniform float resolutionScale;
+
+// gaussian blur of lighting fused into composition, so blurred lighting never has to be written to framebuffer
+vec3 getBlurredLighting(vec2 maxCoords)
+{
+    float offset = resolutionScale / 300.0;
+
+    vec2 offsets[9] = vec2[](
+        vec2(-offset,  offset), // top-left
+        vec2( 0.0f,    offset), // top-center
+        vec2( offset,  offset), // top-right
+        vec2(-offset,  0.0f),   // center-left
+        vec2( 0.0f,    0.0f),   // center-center
+        vec2( offset,  0.0f),   // center-right
+        vec2(-offset, -offset), // bottom-left
+        vec2( 0.0f,   -offset), // bottom-center
+        vec2( offset, -offset)  // bottom-right    
+    );
+
+    float kernel[9] = float[](
+		0.101107,  0.123317,  0.101107,
+        0.1233171, 0.132546,  0.123317,
+        0.101107,  0.1233171, 0.101107
+    );
+
+    vec3 col = vec3(0.0);
+    for(int i = 0; i < 9; i++)
+        col += vec3(texture(lightingTexture, min(texCoords + offsets[i], maxCoords))) * kernel[i];
+    return col;
+}
+
+void main()
+{
+    // don't let linear filtering sample texels outside of rendered part of framebuffers
+    vec2 halfTexel = 0.5 / vec2(textureSize(gameObjectsTexture, 0));
+    vec2 maxCoords = vec2(resolutionScale) - halfTexel;
+    vec2 coords = min(texCoords, maxCoords);
+    fragColor = texture(gameObjectsTexture, coords) * vec4(getBlurredLighting(maxCoords), 1.0);
+}
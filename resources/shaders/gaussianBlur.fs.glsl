@@ -5,11 +5,13 @@ in vec2 texCoords;
 out vec4 fragColor;
 
 uniform sampler2D screenTexture;
-
-const float offset = 1.0 / 300.0;  
+uniform float resolutionScale;
 
 void main()
 {
+    // blur radius stays the same on the screen no matter what resolution scale is
+    float offset = resolutionScale / 300.0;
+
     vec2 offsets[9] = vec2[](
         vec2(-offset,  offset), // top-left
         vec2( 0.0f,    offset), // top-center
@@ -28,10 +30,13 @@ void main()
         0.101107,  0.1233171, 0.101107
     );
     
+    // don't sample outside of rendered part of framebuffer
+    vec2 maxCoords = vec2(resolutionScale) - 0.5 / vec2(textureSize(screenTexture, 0));
+
     vec3 sampleTex[9];
     for(int i = 0; i < 9; i++)
     {
-        sampleTex[i] = vec3(texture(screenTexture, texCoords.st + offsets[i]));
+        sampleTex[i] = vec3(texture(screenTexture, min(texCoords.st + offsets[i], maxCoords)));
     }
     vec3 col = vec3(0.0);
     for(int i = 0; i < 9; i++)
@@ -25,11 +25,11 @@ SoundDataHolder::SoundDataHolder()
 		const bool loop = soundNode.getAttribute("loop").toBool();
 		const float maximalFullVolumeDistance = soundNode.getAttribute("maximalFullVolumeDistance").toFloat();
 		const float maximalHearableDistance = soundNode.getAttribute("maximalHearableDistance").toFloat();
-		mAllSoundsData[filePath] = SoundData(volumeMultiplier, loop, maximalFullVolumeDistance, maximalHearableDistance);
+		mAllSoundsData[StringId::intern(filePath)] = SoundData(volumeMultiplier, loop, maximalFullVolumeDistance, maximalHearableDistance);
 	}
 }
 
-auto SoundDataHolder::getSoundData(const std::string& filePath) -> SoundData
+auto SoundDataHolder::getSoundData(StringId filePath) -> SoundData
 {
 	const auto found = mAllSoundsData.find(filePath);
 	return found->second;
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <map>
-#include <string>
+#include "Utilities/stringId.hpp"
+#include <unordered_map>
 
 namespace ph {
 
@@ -21,10 +21,10 @@ class SoundDataHolder
 public:
 	SoundDataHolder();
 
-	auto getSoundData(const std::string& filePath)->SoundData;
+	auto getSoundData(StringId filePath)->SoundData;
 
 private:
-	std::map<std::string, SoundData> mAllSoundsData;
+	std::unordered_map<StringId, SoundData> mAllSoundsData;
 };
 
 }
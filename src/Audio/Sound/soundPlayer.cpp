@@ -24,7 +24,7 @@ void SoundPlayer::loadEverySound()
 	mSoundBuffers.load("sounds/shotgunShot.ogg");
 }
 
-void SoundPlayer::playAmbientSound(const std::string& filePath)
+void SoundPlayer::playAmbientSound(StringId filePath)
 {
 	removeStoppedSounds();
 	if (mSceneMute)
@@ -34,7 +34,7 @@ void SoundPlayer::playAmbientSound(const std::string& filePath)
 	playSound(filePath, mVolume * soundData.mVolumeMultiplier, soundData.mLoop);
 }
 
-void SoundPlayer::playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition)
+void SoundPlayer::playSpatialSound(StringId filePath, const sf::Vector2f soundPosition)
 {
 	removeStoppedSounds();
 	if (mSceneMute)
@@ -45,7 +45,7 @@ void SoundPlayer::playSpatialSound(const std::string& filePath, const sf::Vector
 	playSound(filePath, spatialVolume, soundData.mLoop);
 }
 
-void SoundPlayer::playSound(const std::string& filePath, const float volume, const bool loop)
+void SoundPlayer::playSound(StringId filePath, const float volume, const bool loop)
 {
 	sf::Sound sound;
 	sound.setBuffer(mSoundBuffers.get(filePath));
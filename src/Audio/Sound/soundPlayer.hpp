@@ -13,8 +13,8 @@ class SoundPlayer
 public:
 	SoundPlayer();
 
-	void playAmbientSound(const std::string& filePath);
-	void playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition);
+	void playAmbientSound(StringId filePath);
+	void playSpatialSound(StringId filePath, const sf::Vector2f soundPosition);
 
 	void setListenerPosition(const sf::Vector2f listenerPosition);
 	void setMuted(const bool muted);
@@ -25,7 +25,7 @@ public:
 	void removeEverySound();
 
 private:
-	void playSound(const std::string& filePath, const float volume, const bool loop);
+	void playSound(StringId filePath, const float volume, const bool loop);
 	void loadEverySound();
 	void removeStoppedSounds();
 
@@ -64,7 +64,7 @@ void DebugCounter::initRendererDebug()
 {
 	mRendererDebug->rendererDebugBackground.setFillColor(sf::Color(0, 0, 0, 230));
 	mRendererDebug->rendererDebugBackground.setPosition(0, -185);
-	mRendererDebug->rendererDebugBackground.setSize({260, 101});
+	mRendererDebug->rendererDebugBackground.setSize({260, 111});
 
 	mRendererDebug->allDrawCallsText.setFont(*mFont);
 	mRendererDebug->allDrawCallsText.setPosition(0, -185);
@@ -105,6 +105,10 @@ void DebugCounter::initRendererDebug()
 	mRendererDebug->drawnPointsText.setFont(*mFont);
 	mRendererDebug->drawnPointsText.setPosition(0, -95);
 	mRendererDebug->drawnPointsText.setCharacterSize(10);
+
+	mRendererDebug->resolutionScaleText.setFont(*mFont);
+	mRendererDebug->resolutionScaleText.setPosition(0, -85);
+	mRendererDebug->resolutionScaleText.setCharacterSize(10);
 }
 
 void DebugCounter::update()
@@ -140,6 +144,7 @@ void DebugCounter::draw() const
 		Renderer::submitSFMLObject(mRendererDebug->drawnLinesText);
 		Renderer::submitSFMLObject(mRendererDebug->pointDrawCallsText);
 		Renderer::submitSFMLObject(mRendererDebug->drawnPointsText);
+		Renderer::submitSFMLObject(mRendererDebug->resolutionScaleText);
 	}
 }
 
@@ -203,4 +208,10 @@ void DebugCounter::setNumberOfPointDrawCalls(unsigned nrOfDrawCalls)
 		mRendererDebug->pointDrawCallsText.setString("Point draw calls: " + std::to_string(nrOfDrawCalls));
 }
 
+void DebugCounter::setResolutionScale(float resolutionScale)
+{
+	if(mIsRendererDebugActive)
+		mRendererDebug->resolutionScaleText.setString("Resolution scale: " + std::to_string(resolutionScale));
+}
+
 }
@@ -30,6 +30,7 @@ public:
 	void setNumberOfDrawnLines(unsigned nrOfTexturesDrawnByInstancedRendering);
 	void setNumberOfDrawnPoints(unsigned nrOfDrawnPoints);
 	void setNumberOfPointDrawCalls(unsigned nrOfDrawCalls);
+	void setResolutionScale(float resolutionScale);
 
 private:
 	void initFPSCounter();
@@ -55,6 +56,7 @@ private:
 		sf::Text drawnLinesText;
 		sf::Text pointDrawCallsText;
 		sf::Text drawnPointsText;
+		sf::Text resolutionScaleText;
 		sf::RectangleShape rendererDebugBackground;
 	};
 	std::unique_ptr<RendererDebug> mRendererDebug;	
@@ -10,7 +10,6 @@ namespace ph::component {
 		PathMode pathMode;
 		sf::Vector2f currentDirectionVector;
 		float timeFromStartingThisMove = 0.f;
-		float timeFromLastGrowl;
 		float timeToMoveToAnotherTile;
 	};
 }
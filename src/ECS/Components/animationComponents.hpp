@@ -2,21 +2,24 @@
 
 #include "Resources/animationStatesResources.hpp"
 #include "Utilities/rect.hpp"
+#include "Utilities/stringId.hpp"
 #include <SFML/System/Time.hpp>
-#include <map>
-#include <string>
 #include <vector>
 
 namespace ph::component {
 
 struct AnimationData
 {
-	std::string currentStateName;
+	StringId currentStateName;
 	AnimationStatesData* states;
 	float delay = 0.1f;
 	float elapsedTime = 0.f;
 	std::size_t currentFrameIndex = 0;
 	bool isPlaying;
+
+	// AnimationSystem looks the state up again only when currentStateName changes
+	const StateData* currentState = nullptr;
+	StringId currentStateLookedUpName;
 };
 
 }
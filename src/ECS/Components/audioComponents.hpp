@@ -1,15 +0,0 @@
-#pragma once
-
-namespace ph::component {
-
-	struct AmbientSound
-	{
-		const char* filepath;
-	};
-
-	struct SpatialSound
-	{
-		const char* filepath;
-	};
-
-}
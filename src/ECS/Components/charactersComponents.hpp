@@ -3,11 +3,13 @@
 #include "Utilities/rect.hpp"
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <entt/entity/fwd.hpp>
 #include <set>
 #include <vector>
 
 namespace ph::component {
 	
+	// changes are made with registry.replace(), so GameplayUI updates counters only when they change
 	struct Health
 	{
 		int healthPoints;
@@ -27,10 +29,6 @@ namespace ph::component {
 	{
 	};
 
-	struct InPlayerGunAttackArea
-	{
-	};
-
 	struct FaceDirection
 	{
 		sf::Vector2f direction;
@@ -49,13 +47,10 @@ namespace ph::component {
 		float timeFromDeath = 0.f;
 	};
 
-	struct TaggedToDestroy
-	{
-	};
-
-	struct DamageTag
+	// entity made by EntitiesPool, it's deactivated instead of being destroyed
+	struct Pooled
 	{
-		int amountOfDamage;
+		entt::entity prototype;
 	};
 
 	struct CollisionWithPlayer
@@ -64,6 +59,7 @@ namespace ph::component {
 		bool isCollision;
 	};
 
+	// entity is destroyed after this time
 	struct Lifetime
 	{
 		float lifetime;
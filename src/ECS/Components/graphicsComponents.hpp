@@ -3,7 +3,9 @@
 #include <SFML/Graphics/Color.hpp>
 #include "Renderer/API/camera.hpp"
 #include "Renderer/MinorRenderers/quadData.hpp"
+#include "Utilities/stringId.hpp"
 #include <vector>
+#include <string>
 
 namespace ph{
 
@@ -37,9 +39,9 @@ namespace component {
 	struct Camera
 	{
 		ph::Camera camera;
-		std::string name;
+		StringId name;
 
-		inline static std::string currentCameraName;
+		inline static StringId currentCameraName;
 	};
 
 	struct LightWall
@@ -11,6 +11,7 @@ namespace ph::component {
 	{
 	};
 
+	// changes are made with registry.replace(), so GameplayUI updates counters only when they change
 	struct Bullets
 	{
 		int numOfPistolBullets;
@@ -2,6 +2,7 @@
 
 #include "Utilities/rect.hpp"
 #include "Renderer/MinorRenderers/quadData.hpp"
+#include "Utilities/stringId.hpp"
 #include <vector>
 #include <array>
 
@@ -83,7 +84,7 @@ namespace ph::component {
 
 	struct GunProperties
 	{
-		std::string shotSoundFilepath;
+		StringId shotSoundFilepath;
 		float range;
 		float deflectionAngle;
 		int damage;
@@ -1,24 +1,18 @@
 #pragma once
 
+#include "ECS/particleArena.hpp"
 #include "Renderer/API/texture.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <vector>
 
-namespace ph {
-
-struct Particle
-{
-	sf::Vector2f position;
-	sf::Vector2f velocity;
-	float lifetime = 0.f;
-};
-
-namespace component {
+namespace ph::component {
 
 struct ParticleEmitter
 {
-	std::vector<Particle> particles;
+	// particles are kept in ParticleArena of PatricleSystem, range is allocated when emitter is updated for the first time,
+	// so emitters can be copied only before that
+	ParticleArena::RangeId particleRange = ParticleArena::sNullRange;
 
 	const Texture* parTexture = nullptr;
 	sf::Vector2f spawnPositionOffset = {0.f, 0.f};
@@ -35,7 +29,6 @@ struct ParticleEmitter
 	unsigned char parZ = 90;
 	bool oneShot = false;
 	bool isEmitting = true;
-	bool wasInitialized = false;
 };
 
 struct MultiParticleEmitter
@@ -43,4 +36,4 @@ struct MultiParticleEmitter
 	std::vector<ParticleEmitter> particleEmitters;
 };
 
-}}
+}
@@ -10,6 +10,12 @@ namespace ph::component {
 		ph::FloatRect rect;
 	};
 
+	// BodyRect from before the last fixed step, renderer interpolates between these two rects
+	struct PreviousBodyRect
+	{
+		ph::FloatRect rect;
+	};
+
 	struct Velocity
 	{
 		float dx, dy;
@@ -35,11 +41,27 @@ namespace ph::component {
 		std::vector<ph::FloatRect> rects;
 		ph::FloatRect sharedBounds;
 	};
+
+	// whole map with one bit per tile, collisions which fill whole tiles are stored here instead of rect lists
+	struct TileCollisionBitmap
+	{
+		std::vector<bool> solidTiles;
+		sf::Vector2u mapSize;
+		sf::Vector2f tileSize;
+
+		bool isSolid(unsigned x, unsigned y) const { return solidTiles[y * mapSize.x + x]; }
+	};
 	
 	struct KinematicCollisionBody 
 	{
 		float mass;
 		bool staticallyMovedByX;
 		bool staticallyMovedByY;
+		float timeAtRest = 0.f;
+	};
+
+	// body which was at rest for some time, it's skipped by movement and collision systems until SleepingBodies wakes it
+	struct Sleeping
+	{
 	};
 }
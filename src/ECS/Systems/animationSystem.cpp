@@ -1,27 +1,46 @@
 #include "animationSystem.hpp"
 #include "ECS/Components/animationComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
+#include "ECS/parallelForEach.hpp"
 #include "Utilities/profiling.hpp"
+#include <atomic>
+#include <iterator>
 
 namespace ph::system {
 
+void AnimationSystem::declareAccess(SystemAccess& access) const
+{
+	access.writes<component::AnimationData, component::TextureRect>();
+}
+
 void AnimationSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
-	auto view = mRegistry.view<component::AnimationData, component::TextureRect>();
+	// counters are incremented only for work which is done, so they are rarely touched by many threads at once
+	std::atomic<size_t> nrOfStateLookups{0}, nrOfTextureRectUpdates{0};
 
-	for(auto entity : view)
+	parallelForEach<component::AnimationData, component::TextureRect>(mRegistry,
+	[dt, &nrOfStateLookups, &nrOfTextureRectUpdates](component::AnimationData& animationData, component::TextureRect& textureRect)
 	{
-		auto& [animationData, textureRect] = view.get<component::AnimationData, component::TextureRect>(entity);
-		
+		// systems set state name every update, but it rarely changes
+		const bool hasStateChanged = !animationData.currentState || animationData.currentStateName != animationData.currentStateLookedUpName;
+		if(hasStateChanged)
+		{
+			animationData.currentState = &animationData.states->at(animationData.currentStateName);
+			animationData.currentStateLookedUpName = animationData.currentStateName;
+			nrOfStateLookups.fetch_add(1, std::memory_order_relaxed);
+		}
+		const StateData& state = *animationData.currentState;
+
 		if(animationData.isPlaying)
 		{
 			animationData.elapsedTime += dt;
+			if(animationData.elapsedTime >= animationData.delay)
+				nrOfTextureRectUpdates.fetch_add(1, std::memory_order_relaxed);
 			while(animationData.elapsedTime >= animationData.delay)
 			{
 				animationData.elapsedTime -= animationData.delay;
-				StateData& state = animationData.states->at(animationData.currentStateName);
 				if(++animationData.currentFrameIndex >= state.frameCount)
 					animationData.currentFrameIndex = 0;
 				textureRect.rect = IntRect(
@@ -32,9 +51,10 @@ void AnimationSystem::update(float dt)
 				);
 			}
 		}
-		else 
+		// stopped animation already shows the first frame of its state
+		else if(hasStateChanged || animationData.currentFrameIndex != 0)
 		{
-			StateData& state = animationData.states->at(animationData.currentStateName);
+			nrOfTextureRectUpdates.fetch_add(1, std::memory_order_relaxed);
 			animationData.currentFrameIndex = 0;
 			textureRect.rect = IntRect(
 				state.startFrame.left,
@@ -43,7 +63,14 @@ void AnimationSystem::update(float dt)
 				state.startFrame.height
 			);
 		}
-	}
+	});
+
+	auto animations = mRegistry.view<component::AnimationData, component::TextureRect>();
+	mNrOfAnimations = std::distance(animations.begin(), animations.end());
+	mNrOfStateLookups = nrOfStateLookups;
+	mNrOfTextureRectUpdates = nrOfTextureRectUpdates;
+	PH_PROFILE_COUNTER("AnimationSystem skipped state lookups", getNrOfSkippedStateLookups());
+	PH_PROFILE_COUNTER("AnimationSystem skipped texture rect updates", getNrOfSkippedTextureRectUpdates());
 }
 
 }
@@ -10,6 +10,16 @@ public:
 	using System::System;
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
+
+	// work skipped in the last update, because states of animations and stopped animations didn't change
+	size_t getNrOfSkippedStateLookups() const { return mNrOfAnimations - mNrOfStateLookups; }
+	size_t getNrOfSkippedTextureRectUpdates() const { return mNrOfAnimations - mNrOfTextureRectUpdates; }
+
+private:
+	size_t mNrOfAnimations = 0;
+	size_t mNrOfStateLookups = 0;
+	size_t mNrOfTextureRectUpdates = 0;
 };
 
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #include "GUI/gui.hpp"
 #include "AI/aiManager.hpp"
 #include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/entitiesPool.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/aiComponents.hpp"
@@ -24,6 +25,21 @@ ArcadeMode::ArcadeMode(entt::registry& registry, GUI& gui, AIManager& aiManager,
 {
 	sIsActive = true;
 	mAIManager.setAIMode(AIMode::zombieAlwaysLookForPlayer);
+
+	// killed zombies are reused by next waves
+	auto& zombiesPool = mRegistry.set<EntitiesPool>(templateStorage);
+	zombiesPool.addComponentTypes<
+		component::Health, component::KinematicCollisionBody, component::Damage, component::CollisionWithPlayer,
+		component::BodyRect, component::PreviousBodyRect, component::CharacterSpeed, component::Velocity,
+		component::PushingForces, component::Sleeping, component::Zombie, component::AnimationData, component::Killable,
+		component::RenderQuad, component::TextureRect, component::MultiParticleEmitter,
+		component::DamageAnimation, component::DeadCharacter>();
+}
+
+void ArcadeMode::declareAccess(SystemAccess& access) const
+{
+	// creates zombies from templates
+	access.runsExclusively();
 }
 
 void ArcadeMode::update(float dt)
@@ -36,10 +52,8 @@ void ArcadeMode::update(float dt)
 	// init bullets
 	if(!mMadeInit) {
 		auto players = mRegistry.view<component::Player, component::Bullets>();
-		players.each([](const component::Player, component::Bullets& bullets) {
-			bullets.numOfPistolBullets = 200;
-			bullets.numOfShotgunBullets = 0;
-		});
+		for(auto player : players)
+			mRegistry.replace<component::Bullets>(player, 200, 0);
 		mMadeInit = true;
 	}
 
@@ -66,37 +80,44 @@ void ArcadeMode::update(float dt)
 	// spawn enemies after new wave
 	if(mShouldSpawnEnemies) {
 		auto spawners = mRegistry.view<component::ArcadeSpawner, component::BodyRect>();
-		spawners.each([dt, this](component::ArcadeSpawner& arcadeModeSpawner, const component::BodyRect& spawnerBody) 
+		std::vector<sf::Vector2f> normalZombiesPositions;
+		std::vector<sf::Vector2f> slowZombiesPositions;
+		spawners.each([dt, this, &normalZombiesPositions, &slowZombiesPositions](component::ArcadeSpawner& arcadeModeSpawner, const component::BodyRect& spawnerBody) 
 		{
+			// ArcadeMode is updated only every few steps, so time over the spawn interval is kept for the next spawn
 			arcadeModeSpawner.timeFromLastSpawn += dt;
-			if(arcadeModeSpawner.timeFromLastSpawn > 0.5f) 
+			if(arcadeModeSpawner.timeFromLastSpawn >= 0.5f) 
 			{
-				arcadeModeSpawner.timeFromLastSpawn = 0.f;
+				arcadeModeSpawner.timeFromLastSpawn -= 0.5f;
 				const sf::Vector2f spawnPos = Random::generateVector(spawnerBody.rect.getTopLeft(), spawnerBody.rect.getBottomRight());
 				auto& wave = arcadeModeSpawner.waves[mCurrentWave - 1];
 				if(wave.normalZombiesToSpawn > 0 && wave.slowZombiesToSpawn > 0) {
 					int ran = Random::generateNumber(0, 5);
 					if(ran == 0) {
-						createNormalZombie(spawnPos);
+						normalZombiesPositions.emplace_back(spawnPos);
 						--wave.normalZombiesToSpawn;
 					}
 					else {
-						createSlowZombie(spawnPos);
+						slowZombiesPositions.emplace_back(spawnPos);
 						--wave.slowZombiesToSpawn;
 					}
 				}
 				else if(wave.normalZombiesToSpawn > 0) {
-					createNormalZombie(spawnPos);
+					normalZombiesPositions.emplace_back(spawnPos);
 					--wave.normalZombiesToSpawn;
 				}
 				else if(wave.slowZombiesToSpawn > 0) {
-					createSlowZombie(spawnPos);
+					slowZombiesPositions.emplace_back(spawnPos);
 					--wave.slowZombiesToSpawn;
 				}
 				else
 					mShouldSpawnEnemies = false;
 			}
 		});
+
+		// zombies from all spawners are created at once
+		createZombies("Zombie", normalZombiesPositions);
+		createZombies("SlowZombie", slowZombiesPositions);
 	}
 
 	// update enemies counter
@@ -188,18 +209,17 @@ void ArcadeMode::updateGuiCounters()
 	}
 }
 
-void ArcadeMode::createNormalZombie(sf::Vector2f position)
+void ArcadeMode::createZombies(const std::string& templateName, const std::vector<sf::Vector2f>& positions)
 {
-	auto zombie = mTemplateStorage.createCopy("Zombie", mRegistry);
-	auto& body = mRegistry.get<component::BodyRect>(zombie);
-	body.rect.setPosition(position);
-}
+	if(positions.empty())
+		return;
 
-void ArcadeMode::createSlowZombie(sf::Vector2f position)
-{
-	auto slowZombie = mTemplateStorage.createCopy("SlowZombie", mRegistry);
-	auto& body = mRegistry.get<component::BodyRect>(slowZombie);
-	body.rect.setPosition(position);
+	auto zombies = mRegistry.ctx<EntitiesPool>().createCopies(templateName, mRegistry, positions.size());
+	for(size_t i = 0; i < zombies.size(); ++i)
+	{
+		auto& body = mRegistry.get<component::BodyRect>(zombies[i]);
+		body.rect.setPosition(positions[i]);
+	}
 }
 
 std::string ArcadeMode::addZero(int number)
@@ -17,6 +17,7 @@ public:
 	ArcadeMode(entt::registry&, GUI&, AIManager&, MusicPlayer&, EntitiesTemplateStorage&);
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 	static bool isActive() { return sIsActive; }
 
@@ -26,8 +27,7 @@ private:
 	void startBreakTime();
 	void endBreakTime();
 	std::string addZero(int number);
-	void createNormalZombie(sf::Vector2f position);
-	void createSlowZombie(sf::Vector2f position);
+	void createZombies(const std::string& templateName, const std::vector<sf::Vector2f>& positions);
 
 private:
 	GUI& mGui;
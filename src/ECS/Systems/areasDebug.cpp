@@ -6,6 +6,13 @@
 
 namespace ph::system {
 
+void AreasDebug::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::StaticCollisionBody, component::MultiStaticCollisionBody, component::TileCollisionBitmap, component::KinematicCollisionBody,
+	             component::AreaVelocityChangingEffect, component::PushingArea, component::BodyRect>()
+	      .submitsToRenderer();
+}
+
 void AreasDebug::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -31,6 +38,17 @@ void AreasDebug::update(float dt)
 			}
 		});
 
+		// render solid tiles of collision bitmap as bright red rectangle
+		auto collisionBitmaps = mRegistry.view<component::TileCollisionBitmap>();
+		collisionBitmaps.each([](const component::TileCollisionBitmap& bitmap)
+		{
+			for(unsigned y = 0; y < bitmap.mapSize.y; ++y)
+				for(unsigned x = 0; x < bitmap.mapSize.x; ++x)
+					if(bitmap.isSolid(x, y))
+						Renderer::submitQuad(nullptr, nullptr, &sf::Color(255, 0, 0, 140), nullptr,
+							sf::Vector2f(x * bitmap.tileSize.x, y * bitmap.tileSize.y), bitmap.tileSize, 50, 0.f, {});
+		});
+
 		// render kinematic bodies as blue rectangle
 		auto kinematicBodies = mRegistry.view<component::KinematicCollisionBody, component::BodyRect>();
 		kinematicBodies.each([](const component::KinematicCollisionBody, const component::BodyRect& body)
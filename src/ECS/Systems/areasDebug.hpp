@@ -10,6 +10,7 @@ public:
 	using System::System;
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 	static void setIsCollisionDebugActive(bool isActive) { sIsCollisionDebugActive = isActive; }
 	static void setIsVelocityChangingAreaDebugActive(bool isActive) { sIsVelocityChangingAreaDebugActive = isActive; }
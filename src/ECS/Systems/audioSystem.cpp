@@ -1,32 +1,31 @@
 #include "audioSystem.hpp"
-#include "arcadeMode.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
-#include "ECS/Components/audioComponents.hpp"
-#include "Audio/Music/musicPlayer.hpp"
+#include "ECS/events.hpp"
 #include "Audio/Sound/soundPlayer.hpp"
-#include "Utilities/math.hpp"
 #include "Utilities/profiling.hpp"
 #include <SFML/System/Vector2.hpp>
 
 namespace ph::system {
 
-	AudioSystem::AudioSystem(entt::registry& registry, MusicPlayer& musicPlayer, SoundPlayer& soundPlayer)
+	AudioSystem::AudioSystem(entt::registry& registry, SoundPlayer& soundPlayer)
 		:System(registry)
-		,mMusicPlayer(musicPlayer)
 		,mSoundPlayer(soundPlayer)
 	{
 		mSoundDistancesFromPlayer.reserve(10);
 	}
 
+	void AudioSystem::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::BodyRect>()
+		      .receives<event::AmbientSound, event::SpatialSound>()
+		      .uses<SoundPlayer>();
+	}
+
 	void AudioSystem::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
-		// define constants
-		constexpr float distanceToEnemyToSwitchToAttackTheme = 270.f;
-		constexpr float distanceToEnemyToSwitchToExplorationTheme = 350.f;
-
 		// get player position
 		sf::Vector2f playerPos(-10000, -10000);
 		auto playerView = mRegistry.view<component::Player, component::BodyRect>();
@@ -34,54 +33,12 @@ namespace ph::system {
 			playerPos = body.rect.getCenter();
 		});
 
-		if(!ArcadeMode::isActive())
-		{
-			// get the closest enemy distance from player
-			float theClosestEnemyDistanceFromPlayer = 1000;
-			auto enemiesView = mRegistry.view<component::Damage, component::BodyRect>();
-			enemiesView.each([&theClosestEnemyDistanceFromPlayer, playerPos](const component::Damage, const component::BodyRect& body) 
-			{
-				const sf::Vector2f enemyPos = body.rect.getCenter();
-				const float enemyDistanceFromPlayer = Math::distanceBetweenPoints(enemyPos, playerPos);
-				if(theClosestEnemyDistanceFromPlayer > enemyDistanceFromPlayer)
-					theClosestEnemyDistanceFromPlayer = enemyDistanceFromPlayer;
-			});
-
-			// switch themes if they should be switched
-			Theme themeTypeWhichShouldBePlayed;
-			if(theClosestEnemyDistanceFromPlayer < distanceToEnemyToSwitchToAttackTheme)
-				themeTypeWhichShouldBePlayed = Theme::Fight;
-			else if(theClosestEnemyDistanceFromPlayer > distanceToEnemyToSwitchToExplorationTheme)
-				themeTypeWhichShouldBePlayed = Theme::Exploration;
-			else
-				themeTypeWhichShouldBePlayed = mCurrentlyPlayerTheme;
-
-			if(themeTypeWhichShouldBePlayed != mCurrentlyPlayerTheme) {
-				mCurrentlyPlayerTheme = themeTypeWhichShouldBePlayed;
-				if(mCurrentlyPlayerTheme == Theme::Fight)
-					mMusicPlayer.playFromMusicState("fight");
-				else
-					mMusicPlayer.playFromMusicState("exploration");
-			}
-		}
-
-		// play and destroy ambient sounds
-		auto ambientSoundsView = mRegistry.view<component::AmbientSound>();
-		for(auto& entity : ambientSoundsView)
-		{
-			const auto& ambientSound = ambientSoundsView.get<component::AmbientSound>(entity);
+		// play sounds sent in this frame
+		for(const auto& ambientSound : mRegistry.ctx<EventQueue<event::AmbientSound>>())
 			mSoundPlayer.playAmbientSound(ambientSound.filepath);
-			mRegistry.remove<component::AmbientSound>(entity);
-		}
 
-		// play and destroy spatial sounds
 		mSoundPlayer.setListenerPosition(playerPos);
-		auto spatialSoundsView = mRegistry.view<component::SpatialSound, component::BodyRect>();
-		for(auto& entity : spatialSoundsView)
-		{
-			const auto& [spatialSound, body] = spatialSoundsView.get<component::SpatialSound, component::BodyRect>(entity);
-			mSoundPlayer.playSpatialSound(spatialSound.filepath, body.rect.getCenter());
-			mRegistry.remove<component::SpatialSound>(entity);
-		}
+		for(const auto& spatialSound : mRegistry.ctx<EventQueue<event::SpatialSound>>())
+			mSoundPlayer.playSpatialSound(spatialSound.filepath, spatialSound.position);
 	}
 }
@@ -4,7 +4,6 @@
 #include <vector>
 
 namespace ph {
-	class MusicPlayer;
 	class SoundPlayer;
 }
 
@@ -13,17 +12,14 @@ namespace ph::system {
 	class AudioSystem : public System
 	{
 	public:
-		AudioSystem(entt::registry& registry, MusicPlayer&, SoundPlayer&);
+		AudioSystem(entt::registry& registry, SoundPlayer&);
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	private:
-		MusicPlayer& mMusicPlayer;
 		SoundPlayer& mSoundPlayer;
 
-		enum class Theme { Exploration, Fight };
-		Theme mCurrentlyPlayerTheme = Theme::Exploration;
-
 		std::vector<float> mSoundDistancesFromPlayer;
 	};
 }
@@ -0,0 +1,51 @@
+#include "bodyRectsSnapshot.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+#include "Utilities/profiling.hpp"
+#include "Utilities/math.hpp"
+#include <vector>
+
+namespace ph::system {
+
+	void BodyRectsSnapshot::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::BodyRect, component::RenderQuad, component::LightSource>()
+		      .writes<component::PreviousBodyRect>();
+	}
+
+	void BodyRectsSnapshot::update(float dt)
+	{
+		PH_PROFILE_FUNCTION();
+
+		auto snapshots = mRegistry.view<component::PreviousBodyRect, component::BodyRect>();
+		snapshots.each([](component::PreviousBodyRect& previous, const component::BodyRect& body) {
+			previous.rect = body.rect;
+		});
+
+		// new entities start without interpolation
+		std::vector<entt::entity> newEntities;
+		mRegistry.view<component::RenderQuad, component::BodyRect>(entt::exclude<component::PreviousBodyRect>).each(
+			[&newEntities](entt::entity entity, const component::RenderQuad&, const component::BodyRect&) {
+				newEntities.emplace_back(entity);
+		});
+		mRegistry.view<component::LightSource, component::BodyRect>(entt::exclude<component::PreviousBodyRect>).each(
+			[&newEntities](entt::entity entity, const component::LightSource&, const component::BodyRect&) {
+				newEntities.emplace_back(entity);
+		});
+		for(auto entity : newEntities)
+			mRegistry.assign_or_replace<component::PreviousBodyRect>(entity, mRegistry.get<component::BodyRect>(entity).rect);
+	}
+
+	sf::Vector2f BodyRectsSnapshot::getInterpolatedPosition(const entt::registry& registry, entt::entity entity, const FloatRect& bodyRect, float factor)
+	{
+		if(auto* previous = registry.try_get<component::PreviousBodyRect>(entity))
+			return Math::lerp(previous->rect.getTopLeft(), bodyRect.getTopLeft(), factor);
+		return bodyRect.getTopLeft();
+	}
+
+	void BodyRectsSnapshot::skipInterpolation(entt::registry& registry, entt::entity entity)
+	{
+		if(auto* previous = registry.try_get<component::PreviousBodyRect>(entity))
+			previous->rect = registry.get<component::BodyRect>(entity).rect;
+	}
+}
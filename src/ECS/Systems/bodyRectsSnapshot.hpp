@@ -0,0 +1,25 @@
+#pragma once
+
+#include "ECS/system.hpp"
+#include "Utilities/rect.hpp"
+#include <SFML/System/Vector2.hpp>
+
+namespace ph::system {
+
+	// saves BodyRects of rendered entities before every fixed step, so RenderSystem can interpolate them
+	class BodyRectsSnapshot : public System
+	{
+	public:
+		using System::System;
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+		// top left corner of the entity between its two last fixed step positions,
+		// entities which don't have PreviousBodyRect yet are at their BodyRect
+		static sf::Vector2f getInterpolatedPosition(const entt::registry&, entt::entity, const FloatRect& bodyRect, float factor);
+
+		// entity which was teleported is drawn at its new position at once instead of sliding there from the old one
+		static void skipInterpolation(entt::registry&, entt::entity);
+	};
+}
@@ -1,13 +1,18 @@
 #include "cars.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/parallelForEach.hpp"
 
 namespace ph::system {
 
+void Cars::declareAccess(SystemAccess& access) const
+{
+	access.writes<component::Car, component::BodyRect>();
+}
+
 void Cars::update(float dt)
 {
-	auto cars = mRegistry.view<component::Car, component::BodyRect>();
-	cars.each([dt](component::Car& car, component::BodyRect& body) 
+	parallelForEach<component::Car, component::BodyRect>(mRegistry, [dt](component::Car& car, component::BodyRect& body)
 	{
 		if(car.shouldSpeedUp)
 			car.velocity += car.acceleration * dt;
@@ -23,6 +23,12 @@ CutScenesActivating::CutScenesActivating(entt::registry& registry, CutSceneManag
 {
 }
 
+void CutScenesActivating::declareAccess(SystemAccess& access) const
+{
+	// cutscenes take over the whole registry
+	access.runsExclusively();
+}
+
 void CutScenesActivating::update(float dt)
 {
 	// get player position
@@ -21,6 +21,7 @@ public:
 	CutScenesActivating(entt::registry&, CutSceneManager&, GUI&, MusicPlayer&, SoundPlayer&, AIManager&, SceneManager&);
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 private:
 	void activateCutscene(const std::string& name) const;
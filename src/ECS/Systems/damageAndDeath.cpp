@@ -4,10 +4,13 @@
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/animationComponents.hpp"
+#include "ECS/events.hpp"
+#include "ECS/timerWheel.hpp"
 #include "GUI/gui.hpp"
 #include "AI/aiManager.hpp"
 #include "Logs/logs.hpp"
 #include "Utilities/profiling.hpp"
+#include <algorithm>
 
 namespace ph::system {
 
@@ -18,6 +21,13 @@ namespace ph::system {
 	{
 	}
 
+	void DamageAndDeath::declareAccess(SystemAccess& access) const
+	{
+		// creates entities and changes components of dead characters
+		access.receives<event::Damage>()
+		      .runsExclusively();
+	}
+
 	void DamageAndDeath::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
@@ -30,13 +40,13 @@ namespace ph::system {
 
 	void DamageAndDeath::dealDamage() const
 	{
-		auto view = mRegistry.view<component::DamageTag, component::Health>();
-		for (auto entity : view)
+		for (const auto& damage : mRegistry.ctx<EventQueue<event::Damage>>())
 		{
-			auto& [damageTag, health] = view.get<component::DamageTag, component::Health>(entity);
-			health.healthPoints -= damageTag.amountOfDamage;
-			mRegistry.remove<component::DamageTag>(entity);
-			mRegistry.assign_or_replace<component::DamageAnimation>(entity, 0.14f);
+			if (auto* health = mRegistry.try_get<component::Health>(damage.entity))
+			{
+				mRegistry.replace<component::Health>(damage.entity, health->healthPoints - damage.amountOfDamage, health->maxHealthPoints);
+				mRegistry.assign_or_replace<component::DamageAnimation>(damage.entity, 0.14f);
+			}
 		}
 	}
 
@@ -113,7 +123,9 @@ namespace ph::system {
 				PH_ASSERT_UNEXPECTED_SITUATION(mRegistry.has<component::RenderQuad>(entity), "Hurt enemy must have RenderQuad!");
 				PH_ASSERT_UNEXPECTED_SITUATION(mRegistry.has<component::AnimationData>(entity), "Hurt enemy must have AnimationData!");
 
-				mRegistry.assign<component::DeadCharacter>(entity, 10.f);
+				// dead body is destroyed when it fades out
+				const auto& deadCharacter = mRegistry.assign<component::DeadCharacter>(entity, 10.f);
+				mRegistry.ctx<TimerWheel>().scheduleEvent<event::Destroy>(entity, deadCharacter.timeToFadeOut);
 				mRegistry.remove<component::Health>(entity);
 				mRegistry.reset<component::Killable>(entity);
 				mRegistry.reset<component::KinematicCollisionBody>(entity);
@@ -159,9 +171,7 @@ namespace ph::system {
 			auto& [deadCharacter, renderQuad] = view.get<component::DeadCharacter, component::RenderQuad>(entity);
 			
 			// fade out
-			deadCharacter.timeToFadeOut -= dt;
-			if(deadCharacter.timeToFadeOut < 0.f)
-				mRegistry.assign<component::TaggedToDestroy>(entity);
+			deadCharacter.timeToFadeOut = std::max(deadCharacter.timeToFadeOut - dt, 0.f);
 			auto alpha = static_cast<unsigned char>(deadCharacter.timeToFadeOut * 25.5f);
 			renderQuad.color = sf::Color(255, 255, 255, alpha);
 
@@ -15,6 +15,7 @@ namespace ph::system {
 		DamageAndDeath(entt::registry&, GUI&, AIManager&);
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	private:
 		void dealDamage() const;
@@ -1,15 +1,43 @@
 #include "entityDestroying.hpp"
 #include "ECS/Components/charactersComponents.hpp"
+#include "ECS/entitiesPool.hpp"
+#include "ECS/events.hpp"
 #include "Utilities/profiling.hpp"
+#include <algorithm>
 
 namespace ph::system {
 
+	void EntityDestroying::declareAccess(SystemAccess& access) const
+	{
+		// destroys entities
+		access.receives<event::Destroy>()
+		      .runsExclusively();
+	}
+
 	void EntityDestroying::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto view = mRegistry.view<component::TaggedToDestroy>();
-		mRegistry.destroy(view.begin(), view.end());
+		// many systems can send destroy event of the same entity
+		const auto& destroyEvents = mRegistry.ctx<EventQueue<event::Destroy>>();
+		mEntitiesToDestroy.clear();
+		for(const auto& destroyEvent : destroyEvents)
+			mEntitiesToDestroy.emplace_back(destroyEvent.entity);
+		std::sort(mEntitiesToDestroy.begin(), mEntitiesToDestroy.end());
+		mEntitiesToDestroy.erase(std::unique(mEntitiesToDestroy.begin(), mEntitiesToDestroy.end()), mEntitiesToDestroy.end());
+
+		auto* entitiesPool = mRegistry.try_ctx<EntitiesPool>();
+		for(auto entity : mEntitiesToDestroy)
+		{
+			if(!mRegistry.valid(entity))
+				continue;
+
+			// pooled entities wait for reuse instead
+			if(entitiesPool && mRegistry.has<component::Pooled>(entity))
+				entitiesPool->deactivate(entity, mRegistry);
+			else
+				mRegistry.destroy(entity);
+		}
 	}
 
 }
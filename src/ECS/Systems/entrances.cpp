@@ -5,6 +5,7 @@
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
 
 #include "Utilities/profiling.hpp"
 
@@ -16,19 +17,32 @@ Entrances::Entrances(entt::registry& registry, SceneManager& sceneManager)
 {
 }
 
+void Entrances::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Player, component::Entrance, component::BodyRect>()
+	      .uses<SceneManager>()
+	      .usesReadOnly<SpatialHash>();
+}
+
 void Entrances::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
 	auto playerView = mRegistry.view<component::Player, component::BodyRect>();
 	auto entrancesView = mRegistry.view<component::Entrance, component::BodyRect>();
+	const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+	std::vector<entt::entity> entrancesNearPlayer;
 
 	for (auto player : playerView)
 	{
 		const auto& playerBody = playerView.get<component::BodyRect>(player);
 
-		for (auto entrance : entrancesView)
+		spatialHash.queryPoint(playerBody.rect.getCenter(), entrancesNearPlayer);
+		for (auto entrance : entrancesNearPlayer)
 		{
+			if (!entrancesView.contains(entrance))
+				continue;
+
 			const auto& entranceBody = entrancesView.get<component::BodyRect>(entrance);
 			if (entranceBody.rect.contains(playerBody.rect.getCenter()))
 			{
@@ -16,6 +16,7 @@ public:
 	Entrances(entt::registry& registry, SceneManager& sceneManager);
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 private:
 	SceneManager& mSceneManager;
@@ -11,33 +11,79 @@ GameplayUI::GameplayUI(entt::registry& registry, GUI& gui)
 	:System(registry)
 	,mGui(gui)
 {
+	// systems which change bullets or health of the player replace these components,
+	// they can do it in parallel only with systems which don't touch them, so flag is never set by two threads at once
+	mRegistry.on_construct<component::Bullets>().connect<&GameplayUI::markCountersAsOutdated>(*this);
+	mRegistry.on_replace<component::Bullets>().connect<&GameplayUI::markCountersAsOutdated>(*this);
+	mRegistry.on_construct<component::Health>().connect<&GameplayUI::markCountersAsOutdated>(*this);
+	mRegistry.on_replace<component::Health>().connect<&GameplayUI::markCountersAsOutdated>(*this);
+	mRegistry.on_destroy<component::Health>().connect<&GameplayUI::markCountersAsOutdated>(*this);
+}
+
+GameplayUI::~GameplayUI()
+{
+	mRegistry.on_construct<component::Bullets>().disconnect(*this);
+	mRegistry.on_replace<component::Bullets>().disconnect(*this);
+	mRegistry.on_construct<component::Health>().disconnect(*this);
+	mRegistry.on_replace<component::Health>().disconnect(*this);
+	mRegistry.on_destroy<component::Health>().disconnect(*this);
+}
+
+void GameplayUI::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Player, component::Bullets, component::Health>()
+	      .uses<GUI>();
 }
 
 void GameplayUI::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
+	if(!mAreCountersOutdated) {
+		++mNrOfSkippedUpdates;
+		PH_PROFILE_COUNTER("GameplayUI skipped updates", mNrOfSkippedUpdates);
+		return;
+	}
+
+	if(!mPistolBulletCounter)
+		findCounters();
+
 	auto view = mRegistry.view<component::Player, component::Bullets>();
 	for(auto player : view)
 	{
-		auto* canvas = mGui.getInterface("gameplayCounters")->getWidget("canvas");
-
 		// set bullets counter
 		const auto bullets = view.get<component::Bullets>(player);
-		dynamic_cast<TextWidget*>(canvas->getWidget("pistolBulletCounter"))->setString(std::to_string(bullets.numOfPistolBullets));
-		dynamic_cast<TextWidget*>(canvas->getWidget("shotgunBulletCounter"))->setString(std::to_string(bullets.numOfShotgunBullets));
+		mPistolBulletCounter->setString(std::to_string(bullets.numOfPistolBullets));
+		mShotgunBulletCounter->setString(std::to_string(bullets.numOfShotgunBullets));
 
 		// set health counter
 		if(mRegistry.has<component::Health>(player)) {
 			const auto playerHP = mRegistry.get<component::Health>(player).healthPoints;
-			dynamic_cast<TextWidget*>(canvas->getWidget("vitalityCounter"))->setString(std::to_string(playerHP));
+			mVitalityCounter->setString(std::to_string(playerHP));
 		}
 		else
-			dynamic_cast<TextWidget*>(canvas->getWidget("vitalityCounter"))->setString(std::to_string(0));
+			mVitalityCounter->setString(std::to_string(0));
 
 		// NOTE: We have to take player's health from registry because health component is removed from player after death
 	}
+
+	mAreCountersOutdated = false;
+	++mNrOfCountersUpdates;
+	PH_PROFILE_COUNTER("GameplayUI counters updates", mNrOfCountersUpdates);
+}
+
+void GameplayUI::findCounters()
+{
+	auto* canvas = mGui.getInterface("gameplayCounters")->getWidget("canvas");
+	mPistolBulletCounter = dynamic_cast<TextWidget*>(canvas->getWidget("pistolBulletCounter"));
+	mShotgunBulletCounter = dynamic_cast<TextWidget*>(canvas->getWidget("shotgunBulletCounter"));
+	mVitalityCounter = dynamic_cast<TextWidget*>(canvas->getWidget("vitalityCounter"));
 }
 
+void GameplayUI::markCountersAsOutdated(entt::entity entity)
+{
+	if(mRegistry.has<component::Player>(entity))
+		mAreCountersOutdated = true;
 }
 
+}
@@ -5,18 +5,35 @@
 namespace ph {
 
 class GUI;
+class TextWidget;
 
 namespace system {
 
+// counters are set only after player's Bullets or Health were assigned, replaced or removed
 class GameplayUI : public System
 {
 public:
 	GameplayUI(entt::registry&, GUI&);
+	~GameplayUI();
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
+
+	unsigned getNrOfSkippedUpdates() const { return mNrOfSkippedUpdates; }
+	unsigned getNrOfCountersUpdates() const { return mNrOfCountersUpdates; }
+
+private:
+	void findCounters();
+	void markCountersAsOutdated(entt::entity);
 
 private:
 	GUI& mGui;
+	TextWidget* mPistolBulletCounter = nullptr;
+	TextWidget* mShotgunBulletCounter = nullptr;
+	TextWidget* mVitalityCounter = nullptr;
+	unsigned mNrOfSkippedUpdates = 0;
+	unsigned mNrOfCountersUpdates = 0;
+	bool mAreCountersOutdated = true;
 };
 
 }}
@@ -9,6 +9,13 @@
 
 namespace ph::system {
 
+void Gates::declareAccess(SystemAccess& access) const
+{
+	// hiding gate moves it in RenderQuad pool owned by group of render quads
+	access.writes<component::Gate, component::LeverListener, component::StaticCollisionBody, component::LightWall, component::HiddenForRenderer,
+	              component::RenderQuad>();
+}
+
 void Gates::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
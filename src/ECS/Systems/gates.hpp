@@ -10,6 +10,7 @@ namespace ph::system {
 		using System::System;
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	};
 
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "gunAttacks.hpp"
-#include "ECS/Components/audioComponents.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/itemComponents.hpp"
+#include "ECS/raycasting.hpp"
+#include "ECS/spatialHash.hpp"
+#include "ECS/events.hpp"
 #include "Events/actionEventManager.hpp"
 #include "Renderer/renderer.hpp"
 
@@ -17,6 +19,14 @@
 
 namespace ph::system {
 
+void GunAttacks::declareAccess(SystemAccess& access) const
+{
+	// creates entities of shots
+	access.emits<event::Damage, event::AmbientSound>()
+	      .receivesActions<ActionId::GunAttack, ActionId::ChangeWeapon>()
+	      .runsExclusively();
+}
+
 void GunAttacks::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -29,7 +39,7 @@ void GunAttacks::onEvent(const ActionEvent& event)
 {
 	if (event.mType == ActionEvent::Type::Pressed)
 	{
-		if(event.mAction == "gunAttack") 
+		if(event.mAction == ActionId::GunAttack) 
 		{
 			auto playerGunView = mRegistry.view<component::Player, component::GunAttacker>();
 			for (auto player : playerGunView) {
@@ -37,7 +47,7 @@ void GunAttacks::onEvent(const ActionEvent& event)
 				playerGunAttack.isTryingToAttack = true;
 			}
 		}
-		else if(event.mAction == "changeWeapon")
+		else if(event.mAction == ActionId::ChangeWeapon)
 		{
 			auto currentGunView = mRegistry.view<component::CurrentGun, component::GunProperties>();
 			auto otherGunsView = mRegistry.view<component::GunProperties>(entt::exclude<component::CurrentGun>);
@@ -67,7 +77,7 @@ void GunAttacks::handlePendingGunAttacks() const
 {
 	auto gunAttackerView = mRegistry.view<component::Player, component::GunAttacker, component::Bullets, component::FaceDirection, component::BodyRect>();
 	gunAttackerView.each([this]
-	(const component::Player, component::GunAttacker& playerGunAttack, component::Bullets& playerBullets,
+	(entt::entity player, const component::Player, component::GunAttacker& playerGunAttack, component::Bullets& playerBullets,
 	 const component::FaceDirection playerFaceDirection, const component::BodyRect& playerBody)
 	{
 		if (playerGunAttack.isTryingToAttack)
@@ -86,15 +96,14 @@ void GunAttacks::handlePendingGunAttacks() const
 
 				sf::Vector2f startingBulletPosition = gunBody.rect.getTopLeft() + getBulletStartingPosition(playerFaceDirection.direction);
 
-				tagEnemiesInGunAttackArea(playerFaceDirection.direction, playerBody.rect, gunBody.rect.getSize(), gunProperties.range, gunProperties.deflectionAngle);
 				std::vector<sf::Vector2f> shotsEndingPositions = performShoot(playerFaceDirection.direction, startingBulletPosition, gunProperties.range, gunProperties.deflectionAngle, gunProperties.damage, gunProperties.numberOfBullets);
 				createShotImage(startingBulletPosition, shotsEndingPositions, gunProperties.shotSoundFilepath);
-				clearInGunAttackAreaTags();
 
 				if(gunProperties.type == component::GunProperties::Type::Pistol)
 					--playerBullets.numOfPistolBullets;
 				else if(gunProperties.type == component::GunProperties::Type::Shotgun)
 					--playerBullets.numOfShotgunBullets;
+				mRegistry.replace<component::Bullets>(player, playerBullets);
 			}
 		}
 	});
@@ -114,92 +123,71 @@ sf::Vector2f GunAttacks::getBulletStartingPosition(const sf::Vector2f& playerFac
 		return sf::Vector2f(0.f, 0.f);
 }
 
-void GunAttacks::tagEnemiesInGunAttackArea(sf::Vector2f playerFaceDirection, const FloatRect& playerBody, sf::Vector2f gunSize, float range, float deflectionAngle) const
+std::vector<sf::Vector2f> GunAttacks::performShoot(const sf::Vector2f& playerFaceDirection, const sf::Vector2f& startingBulletPos, float range, float deflectionAngle, int damage, int numberOfBullets) const
 {
-	FloatRect attackArea(playerBody.getCenter(), sf::Vector2f(0.f, 0.f));
-	if (playerFaceDirection == PH_WEST)
-		attackArea.left += range * playerFaceDirection.x;
-	else if (playerFaceDirection == PH_NORTH)
-		attackArea.top += range * playerFaceDirection.y;
-
-	if (playerFaceDirection == PH_WEST || playerFaceDirection == PH_EAST)
-	{
-		attackArea.width = range;
-		attackArea.height = range * std::tan(Math::degreesToRadians(deflectionAngle)) * 2.f;
-
-		attackArea.left += (playerBody.width / 2.f + gunSize.x / 2.f) * playerFaceDirection.x;;
-		attackArea.top -= attackArea.height / 2.f;
-	}
-	else if (playerFaceDirection == PH_SOUTH || playerFaceDirection == PH_NORTH)
-	{
-		attackArea.width = range * std::tan(Math::degreesToRadians(deflectionAngle)) * 2.f;
-		attackArea.height = range;
-
-		attackArea.left -= attackArea.width / 2.f;
-		attackArea.top += (playerBody.height / 2.f + gunSize.y / 2.f) * playerFaceDirection.y;
-	}
-	else if (PH_IS_DIAGONAL(playerFaceDirection))
+	std::vector<sf::Vector2f> bulletsDirections;
+	sf::Vector2f shotsMin = startingBulletPos;
+	sf::Vector2f shotsMax = startingBulletPos;
+	for (int i = 0; i < numberOfBullets; ++i)
 	{
-		attackArea.setSize(sf::Vector2f(range, range));
-		if (PH_IS_X_AXIS_POSITIVE(playerFaceDirection))
-			attackArea.left += playerBody.width / 2.f;
-		else if (PH_IS_X_AXIS_NEGATIVE(playerFaceDirection))
-			attackArea.left -= range + playerBody.width / 2.f;
-		if (PH_IS_Y_AXIS_POSITIVE(playerFaceDirection))
-			attackArea.top += playerBody.height / 2.f;
-		else if (PH_IS_Y_AXIS_NEGATIVE(playerFaceDirection))
-			attackArea.top -= range + playerBody.height / 2.f;
+		sf::Vector2f direction = getBulletDirection(playerFaceDirection, deflectionAngle);
+		sf::Vector2f bulletRangeEnd = getCurrentPosition(direction, startingBulletPos, range);
+		shotsMin = sf::Vector2f(std::min(shotsMin.x, bulletRangeEnd.x), std::min(shotsMin.y, bulletRangeEnd.y));
+		shotsMax = sf::Vector2f(std::max(shotsMax.x, bulletRangeEnd.x), std::max(shotsMax.y, bulletRangeEnd.y));
+		bulletsDirections.emplace_back(direction);
 	}
 
-	auto enemiesView = mRegistry.view<component::Killable, component::BodyRect>(entt::exclude<component::Player>);
-	for (auto enemy : enemiesView)
+	// all bullets of the shot share one query for enemies and walls
+	const FloatRect shotsBounds(shotsMin, shotsMax - shotsMin);
+	std::vector<entt::entity> nearbyObjects;
+	mRegistry.ctx<SpatialHash>().queryRect(shotsBounds, nearbyObjects);
+
+	auto enemies = mRegistry.view<component::Killable, component::BodyRect>(entt::exclude<component::Player>);
+	auto staticObjects = mRegistry.view<component::StaticCollisionBody, component::BodyRect>();
+	auto multiStaticCollisionObjects = mRegistry.view<component::MultiStaticCollisionBody>();
+	std::vector<entt::entity> nearbyEnemies;
+	std::vector<FloatRect> nearbyWalls;
+	for (auto nearbyObject : nearbyObjects)
 	{
-		const auto& enemyBody = enemiesView.get<component::BodyRect>(enemy);
-		if (attackArea.doPositiveRectsIntersect(enemyBody.rect))
-			mRegistry.assign<component::InPlayerGunAttackArea>(enemy);
+		if (enemies.contains(nearbyObject))
+			nearbyEnemies.emplace_back(nearbyObject);
+		else if (staticObjects.contains(nearbyObject))
+			nearbyWalls.emplace_back(staticObjects.get<component::BodyRect>(nearbyObject).rect);
+		else if (multiStaticCollisionObjects.contains(nearbyObject))
+		{
+			for (const FloatRect& rect : multiStaticCollisionObjects.get(nearbyObject).rects)
+				if (rect.doPositiveRectsIntersect(shotsBounds))
+					nearbyWalls.emplace_back(rect);
+		}
 	}
-}
 
-std::vector<sf::Vector2f> GunAttacks::performShoot(const sf::Vector2f& playerFaceDirection, const sf::Vector2f& startingBulletPos, float range, float deflectionAngle, int damage, int numberOfBullets) const
-{
-	auto enemiesWithDamageTag = mRegistry.view<component::DamageTag, component::InPlayerGunAttackArea, component::Killable, component::BodyRect>();
-	auto enemies = mRegistry.view<component::InPlayerGunAttackArea, component::Killable, component::BodyRect>();
+	auto collisionBitmaps = mRegistry.view<component::TileCollisionBitmap>();
 	std::vector<sf::Vector2f> shotsEndingPositions;
-	const int bulletShiftValue = 5;
 
-	for (int i = 0; i < numberOfBullets; ++i)
+	for (const auto& direction : bulletsDirections)
 	{
-		sf::Vector2f direction = getBulletDirection(playerFaceDirection, deflectionAngle);
-		sf::Vector2f currentBulletPos = startingBulletPos;
-		int bulletTravelledDist = 1;
-
-		while (bulletTravelledDist < range)
+		// bullet stops at the closest wall or enemy
+		float hitDistance = range;
+		for (auto collisionBitmap : collisionBitmaps)
+			hitDistance = getRayDistanceToSolidTile(startingBulletPos, direction, collisionBitmaps.get(collisionBitmap), hitDistance);
+		for (const auto& wall : nearbyWalls)
+			hitDistance = getRayDistanceToRect(startingBulletPos, direction, wall, hitDistance);
+
+		entt::entity hitEnemy = entt::null;
+		for (auto enemy : nearbyEnemies)
 		{
-			bool didBulletHitEnemy = false;
-			for (const auto enemy : enemies)
+			float enemyDistance = getRayDistanceToRect(startingBulletPos, direction, enemies.get<component::BodyRect>(enemy).rect, hitDistance);
+			if (enemyDistance < hitDistance)
 			{
-				const auto& bodyRect = enemies.get<component::BodyRect>(enemy);
-				if (bodyRect.rect.contains(currentBulletPos))
-				{
-					if (enemiesWithDamageTag.contains(enemy))
-					{
-						auto& damageTagValue = enemiesWithDamageTag.get<component::DamageTag>(enemy);
-						damageTagValue.amountOfDamage += damage;
-					}
-					else
-						mRegistry.assign<component::DamageTag>(enemy, damage);
-					didBulletHitEnemy = true;
-					break;
-				}
+				hitDistance = enemyDistance;
+				hitEnemy = enemy;
 			}
+		}
 
-			if (didBulletHitEnemy)
-				break;
+		if (hitEnemy != entt::null)
+			mRegistry.ctx<EventQueue<event::Damage>>().emit(hitEnemy, damage);
 
-			bulletTravelledDist += bulletShiftValue;
-			currentBulletPos = getCurrentPosition(direction, startingBulletPos, bulletTravelledDist);
-		}
-		shotsEndingPositions.emplace_back(currentBulletPos);
+		shotsEndingPositions.emplace_back(getCurrentPosition(direction, startingBulletPos, hitDistance));
 	}
 
 	return shotsEndingPositions;
@@ -292,7 +280,7 @@ sf::Vector2f GunAttacks::getBulletDirection(const sf::Vector2f& playerFaceDirect
 	return deflectedBulletDirection;
 }
 
-sf::Vector2f GunAttacks::getCurrentPosition(const sf::Vector2f& bulletDirection, const sf::Vector2f& startingPos, const int bulletDistance) const
+sf::Vector2f GunAttacks::getCurrentPosition(const sf::Vector2f& bulletDirection, const sf::Vector2f& startingPos, float bulletDistance) const
 {
 	sf::Vector2f newPosition;
 	newPosition.x = startingPos.x + bulletDirection.x * bulletDistance;
@@ -300,14 +288,7 @@ sf::Vector2f GunAttacks::getCurrentPosition(const sf::Vector2f& bulletDirection,
 	return newPosition;
 }
 
-void GunAttacks::clearInGunAttackAreaTags() const
-{
-	auto enemiesInAreaAttackView = mRegistry.view<component::InPlayerGunAttackArea>();
-	for (auto enemy : enemiesInAreaAttackView)
-		mRegistry.remove<component::InPlayerGunAttackArea>(enemy);
-}
-
-void GunAttacks::createShotImage(const sf::Vector2f shotsStartingPosition, const std::vector<sf::Vector2f>& shotsEngingPosition, const std::string& soundFilename) const
+void GunAttacks::createShotImage(const sf::Vector2f shotsStartingPosition, const std::vector<sf::Vector2f>& shotsEngingPosition, StringId soundFilename) const
 {
 	for (auto shot : shotsEngingPosition)
 	{
@@ -316,9 +297,7 @@ void GunAttacks::createShotImage(const sf::Vector2f shotsStartingPosition, const
 		mRegistry.assign<component::Lifetime>(entity, .05f);
 	}
 
-	auto soundEntity = mRegistry.create();
-	mRegistry.assign<component::AmbientSound>(soundEntity, soundFilename.c_str());
-	mRegistry.assign<component::Lifetime>(soundEntity, .05f);
+	mRegistry.ctx<EventQueue<event::AmbientSound>>().emit(soundFilename);
 }
 
 void GunAttacks::handleLastingBullets() const
@@ -9,6 +9,13 @@
 
 namespace ph::system {
 
+	void GunPositioningAndTexture::declareAccess(SystemAccess& access) const
+	{
+		// hiding gun moves it in RenderQuad pool owned by group of render quads
+		access.reads<component::Player, component::FaceDirection, component::Bullets, component::GunProperties, component::CurrentGun>()
+		      .writes<component::GunAttacker, component::TextureRect, component::HiddenForRenderer, component::BodyRect, component::RenderQuad>();
+	}
+
 	void GunPositioningAndTexture::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
@@ -13,6 +13,7 @@ public:
 	using System::System;
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 private:
 	void updateTexture(float dt, sf::Vector2f playerFaceDirection, bool wantToAttack) const;
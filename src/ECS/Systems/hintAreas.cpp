@@ -15,6 +15,13 @@ HintAreas::HintAreas(entt::registry& registry, GUI& gui)
 {
 }
 
+void HintAreas::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Player, component::BodyRect>()
+	      .writes<component::Hint>()
+	      .uses<GUI, ActionEventManager>();
+}
+
 void HintAreas::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -39,18 +46,18 @@ void HintAreas::update(float dt)
 
 				// NOTE: This is temporary
 				if(hintDetails.hintName == "controlHint") {
-					ActionEventManager::setActionEnabled("changeWeapon", false);
-					ActionEventManager::setActionEnabled("gunAttack", false);
-					ActionEventManager::setActionEnabled("meleeAttack", false);
+					ActionEventManager::setActionEnabled(ActionId::ChangeWeapon, false);
+					ActionEventManager::setActionEnabled(ActionId::GunAttack, false);
+					ActionEventManager::setActionEnabled(ActionId::MeleeAttack, false);
 				}
 				else if(hintDetails.hintName == "shootingHint") {
-					ActionEventManager::setActionEnabled("gunAttack", true);
+					ActionEventManager::setActionEnabled(ActionId::GunAttack, true);
 				}
 				else if(hintDetails.hintName == "meleeFightingHint") {
-					ActionEventManager::setActionEnabled("meleeAttack", true);
+					ActionEventManager::setActionEnabled(ActionId::MeleeAttack, true);
 				}
 				else if(hintDetails.hintName == "weaponChangingHint") {
-					ActionEventManager::setActionEnabled("changeWeapon", true);
+					ActionEventManager::setActionEnabled(ActionId::ChangeWeapon, true);
 				}
 			}
 			else if (hintDetails.isShown)
@@ -14,6 +14,7 @@ namespace system {
 		HintAreas(entt::registry&, GUI&);
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	private:
 		GUI& mGui;
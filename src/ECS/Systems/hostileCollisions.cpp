@@ -1,44 +1,72 @@
 #include "hostileCollisions.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
+#include "ECS/events.hpp"
 #include "Utilities/rect.hpp"
 #include "Utilities/profiling.hpp"
 #include "Utilities/math.hpp"
+#include <algorithm>
 
 namespace ph::system {
 
+	void HostileCollisions::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::BodyRect, component::Health, component::Damage>()
+		      .writes<component::PushingForces, component::CollisionWithPlayer>()
+		      .emits<event::Damage>()
+		      .usesReadOnly<SpatialHash>();
+	}
+
 	void HostileCollisions::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
 		auto playerView = mRegistry.view<component::Player, component::BodyRect, component::Health, component::PushingForces>();
 		auto enemiesView = mRegistry.view<component::BodyRect, component::Damage, component::CollisionWithPlayer>();
+		const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+		auto& damageEvents = mRegistry.ctx<EventQueue<event::Damage>>();
+		std::vector<entt::entity> nearbyEnemies;
+		std::vector<entt::entity> collidingEnemies;
 
 		for (auto player : playerView)
 		{
 			const auto& playerBody = playerView.get<component::BodyRect>(player);
 			auto& playerPushingForces = playerView.get<component::PushingForces>(player);
 
-			for (auto damageDealingEntitiy : enemiesView)
+			spatialHash.queryRect(playerBody.rect, nearbyEnemies);
+			for (auto damageDealingEntitiy : nearbyEnemies)
 			{
+				if (!enemiesView.contains(damageDealingEntitiy))
+					continue;
+
 				auto& playerCollision = enemiesView.get<component::CollisionWithPlayer>(damageDealingEntitiy);
 				const auto& enemyBody = enemiesView.get<component::BodyRect>(damageDealingEntitiy);
 
 				if (playerBody.rect.doPositiveRectsIntersect(enemyBody.rect))
 				{
+					collidingEnemies.emplace_back(damageDealingEntitiy);
 					if (playerCollision.isCollision)
 						continue;
 					playerCollision.isCollision = true;
 
 					const auto& damage = enemiesView.get<component::Damage>(damageDealingEntitiy);
-					mRegistry.assign<component::DamageTag>(player, damage.damageDealt);
+					damageEvents.emit(player, damage.damageDealt);
 
 					playerPushingForces.vel = playerCollision.pushForce * Math::getUnitVector(playerBody.rect.getCenter() - enemyBody.rect.getCenter());
 					playerPushingForces.friction = 1.f;
 				}
-				else
-					playerCollision.isCollision = false;
 			}
 		}
+
+		// enemies which stopped colliding can deal damage again
+		std::sort(collidingEnemies.begin(), collidingEnemies.end());
+		for (auto enemy : mEnemiesCollidingWithPlayer)
+		{
+			if (mRegistry.valid(enemy) && enemiesView.contains(enemy) &&
+			    !std::binary_search(collidingEnemies.begin(), collidingEnemies.end(), enemy))
+				enemiesView.get<component::CollisionWithPlayer>(enemy).isCollision = false;
+		}
+		mEnemiesCollidingWithPlayer = std::move(collidingEnemies);
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include <vector>
 
 namespace ph::system {
 
@@ -10,5 +11,10 @@ namespace ph::system {
 		using System::System;
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		// only these enemies can have CollisionWithPlayer::isCollision set, so others don't have to be visited
+		std::vector<entt::entity> mEnemiesCollidingWithPlayer;
 	};
 }
@@ -4,6 +4,11 @@
 
 namespace ph::system {
 
+	void IsPlayerAlive::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::Health>();
+	}
+
 	void IsPlayerAlive::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
@@ -1,68 +1,74 @@
 #include "kinematicCollisions.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/registryGroups.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 
+	void KinematicCollisions::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::KinematicCollisionBody, component::Sleeping>()
+		      .writes<component::BodyRect, component::Velocity>();
+	}
+
 	void KinematicCollisions::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto kinematicObjects = mRegistry.view<component::BodyRect, component::Velocity, component::KinematicCollisionBody>();
+		auto kinematicObjects = Groups::kinematicBodies(mRegistry);
 
-		for (auto current = kinematicObjects.begin(); current != kinematicObjects.end(); ++current)
-		{
-			auto& currentBody = kinematicObjects.get<component::BodyRect>(*current);
-			auto& currentVel = kinematicObjects.get<component::Velocity>(*current);
+		// group owns BodyRects, so they are packed in the same order as entities
+		const auto* kinematicBodies = kinematicObjects.raw<component::BodyRect>();
+		const auto* kinematicEntities = kinematicObjects.data();
+		for (size_t i = 0; i < kinematicObjects.size(); ++i)
+			mSweepAndPrune.setBody(kinematicEntities[i], kinematicBodies[i].rect);
+		mSweepAndPrune.update();
 
-			auto another = current;
-			++another;
-			if (another == kinematicObjects.end())
-				break;
+		for (auto [current, another] : mSweepAndPrune.getOverlappingPairs())
+		{
+			auto& currentBody = kinematicObjects.get<component::BodyRect>(current);
+			auto& currentVel = kinematicObjects.get<component::Velocity>(current);
+			auto& anotherBody = kinematicObjects.get<component::BodyRect>(another);
+			auto& anotherVel = kinematicObjects.get<component::Velocity>(another);
 
-			for (; another != kinematicObjects.end(); ++another)
+			// previous pairs could already push these bodies apart
+			if (currentBody.rect.doPositiveRectsIntersect(anotherBody.rect))
 			{
-				auto& anotherBody = kinematicObjects.get<component::BodyRect>(*another);
-				auto& anotherVel = kinematicObjects.get<component::Velocity>(*another);
-
-				if (currentBody.rect.doPositiveRectsIntersect(anotherBody.rect))
-				{
-					component::Velocity newVel = { currentVel.dx + anotherVel.dx, currentVel.dy + anotherVel.dy };
+				component::Velocity newVel = { currentVel.dx + anotherVel.dx, currentVel.dy + anotherVel.dy };
 
-					sf::FloatRect intersection;
-					currentBody.rect.intersects(anotherBody.rect, intersection);
+				sf::FloatRect intersection;
+				currentBody.rect.intersects(anotherBody.rect, intersection);
 
-					if (intersection.width < intersection.height)
+				if (intersection.width < intersection.height)
+				{
+					currentVel.dx = newVel.dx;
+					anotherVel.dx = newVel.dx;
+					auto halfWidth = intersection.width / 2.f;
+					if (currentBody.rect.left < anotherBody.rect.left)
+					{
+						currentBody.rect.left -= halfWidth;
+						anotherBody.rect.left += halfWidth;
+					}
+					else
+					{
+						currentBody.rect.left += halfWidth;
+						anotherBody.rect.left -= halfWidth;
+					}
+				}
+				else
+				{
+					currentVel.dy = newVel.dy;
+					anotherVel.dy = newVel.dy;
+					auto halfHeight = intersection.height / 2.f;
+					if (currentBody.rect.top < anotherBody.rect.top)
 					{
-						currentVel.dx = newVel.dx;
-						anotherVel.dx = newVel.dx;
-						auto halfWidth = intersection.width / 2.f;
-						if (currentBody.rect.left < anotherBody.rect.left)
-						{
-							currentBody.rect.left -= halfWidth;
-							anotherBody.rect.left += halfWidth;
-						}
-						else
-						{
-							currentBody.rect.left += halfWidth;
-							anotherBody.rect.left -= halfWidth;
-						}
+						currentBody.rect.top -= halfHeight;
+						anotherBody.rect.top += halfHeight;
 					}
 					else
 					{
-						currentVel.dy = newVel.dy;
-						anotherVel.dy = newVel.dy;
-						auto halfHeight = intersection.height / 2.f;
-						if (currentBody.rect.top < anotherBody.rect.top)
-						{
-							currentBody.rect.top -= halfHeight;
-							anotherBody.rect.top += halfHeight;
-						}
-						else
-						{
-							currentBody.rect.top += halfHeight;
-							anotherBody.rect.top -= halfHeight;
-						}
+						currentBody.rect.top += halfHeight;
+						anotherBody.rect.top -= halfHeight;
 					}
 				}
 			}
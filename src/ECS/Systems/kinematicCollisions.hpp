@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "ECS/sweepAndPrune.hpp"
 
 namespace ph::system {
 
@@ -10,5 +11,9 @@ namespace ph::system {
 		using System::System;
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		SweepAndPrune mSweepAndPrune;
 	};
 }
@@ -8,6 +8,11 @@
 
 namespace ph::system {
 
+void Levers::declareAccess(SystemAccess& access) const
+{
+	access.receivesActions<ActionId::Use>();
+}
+
 void Levers::update(float dt)
 {
 }
@@ -16,7 +21,7 @@ void Levers::onEvent(const ActionEvent& event)
 {
 	if (event.mType == ActionEvent::Pressed)
 	{
-		if (event.mAction == "use")
+		if (event.mAction == ActionId::Use)
 			handleUsedLevers();
 	}
 }
@@ -12,6 +12,7 @@ public:
 	using System::System;
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 	void onEvent(const ActionEvent& event) override;
 
 private:
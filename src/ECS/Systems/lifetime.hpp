@@ -1,15 +0,0 @@
-#pragma once
-
-#include "ECS/system.hpp"
-
-namespace ph::system {
-
-	class Lifetime : public System
-	{
-	public:
-		using System::System;
-
-		void update(float dt) override;
-
-	};
-}
@@ -5,6 +5,8 @@
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
+#include "ECS/events.hpp"
 #include "Utilities/math.hpp"
 #include "Utilities/direction.hpp"
 #include "Utilities/profiling.hpp"
@@ -13,10 +15,19 @@ namespace ph::system {
 
 void MeleeAttacks::onEvent(const ActionEvent& e)
 {
-	if(e.mType == ActionEvent::Type::Pressed && e.mAction == "meleeAttack" && !mShouldWeaponBeRendered)
+	if(e.mType == ActionEvent::Type::Pressed && e.mAction == ActionId::MeleeAttack && !mShouldWeaponBeRendered)
 		mIsAttackButtonPressed = true;
 }
 
+void MeleeAttacks::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Player, component::FaceDirection, component::CurrentMeleeWeapon, component::MeleeProperties, component::Killable>()
+	      .writes<component::RenderQuad, component::BodyRect, component::PushingForces, component::HiddenForRenderer>()
+	      .emits<event::Damage>()
+	      .usesReadOnly<SpatialHash>()
+	      .receivesActions<ActionId::MeleeAttack>();
+}
+
 void MeleeAttacks::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -48,8 +59,13 @@ void MeleeAttacks::update(float dt)
 					sf::Vector2f(meleeProperties.range * 2, meleeProperties.range * 2)
 				);
 				auto enemies = mRegistry.view<component::Killable, component::BodyRect, component::PushingForces>(entt::exclude<component::Player>);
-				for(auto enemy : enemies)
+				std::vector<entt::entity> entitiesInAttackArea;
+				mRegistry.ctx<SpatialHash>().queryRect(attackArea, entitiesInAttackArea);
+				for(auto enemy : entitiesInAttackArea)
 				{
+					if(!enemies.contains(enemy))
+						continue;
+
 					const auto& enemyBody = enemies.get<component::BodyRect>(enemy);
 					auto& enemyPushingForces = enemies.get<component::PushingForces>(enemy);
 					const sf::Vector2f enemyBodyCenter = enemyBody.rect.getCenter();
@@ -58,7 +74,7 @@ void MeleeAttacks::update(float dt)
 						float enemyAngle = std::atan2f(enemyBodyCenter.y - playerBodyCenter.y, enemyBodyCenter.x - playerBodyCenter.x);
 						enemyAngle = Math::radiansToDegrees(enemyAngle);
 						if(enemyAngle >= mStartWeaponRotation - meleeProperties.rotationRange - 10.f && enemyAngle <= mStartWeaponRotation + 10.f) {
-							mRegistry.assign_or_replace<component::DamageTag>(enemy, meleeProperties.damage);
+							mRegistry.ctx<EventQueue<event::Damage>>().emit(enemy, meleeProperties.damage);
 							enemyPushingForces.vel = sf::Vector2f(faceDirection.direction.x, faceDirection.direction.y) * 3.f;
 							enemyPushingForces.friction = 1.8f;
 						}
@@ -14,6 +14,7 @@ namespace ph::system {
 
 		void onEvent(const ActionEvent&)override;
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	private:
 		float getStartAttackRotation(const sf::Vector2f& playerFaceDirection) const;
@@ -1,25 +1,30 @@
 #include "movement.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/parallelForEach.hpp"
+#include "ECS/registryGroups.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 	
+	void Movement::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Velocity, component::PushingForces, component::Sleeping>()
+		      .writes<component::BodyRect>();
+	}
+
 	void Movement::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto bodiesWithVel = mRegistry.view<component::BodyRect, component::Velocity>(entt::exclude<component::PushingForces>);
-		bodiesWithVel.each([dt](component::BodyRect& body, const component::Velocity& vel) {
+		auto pushingForces = mRegistry.view<component::PushingForces>();
+
+		parallelForEach(Groups::movingBodies(mRegistry), [dt, pushingForces](entt::entity entity, component::BodyRect& body, const component::Velocity& vel) {
+			// pushed bodies are moved by PushingMovement
+			if(pushingForces.contains(entity) && pushingForces.get(entity).vel != sf::Vector2f(0, 0))
+				return;
+
 			body.rect.left += vel.dx * dt;
 			body.rect.top  += vel.dy * dt;
 		});
-
-		auto bodiesWithVelAndPushingVel = mRegistry.view<component::BodyRect, component::Velocity, component::PushingForces>();
-		bodiesWithVelAndPushingVel.each([dt](component::BodyRect& body, const component::Velocity& vel, const component::PushingForces& pushingVel) {
-			if(pushingVel.vel == sf::Vector2f(0, 0)) {
-				body.rect.left += vel.dx * dt;
-				body.rect.top  += vel.dy * dt;
-			}
-		});
 	}
 }
@@ -0,0 +1,70 @@
+#include "musicThemes.hpp"
+#include "arcadeMode.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "Audio/Music/musicPlayer.hpp"
+#include "Utilities/math.hpp"
+#include "Utilities/profiling.hpp"
+#include <SFML/System/Vector2.hpp>
+
+namespace ph::system {
+
+	MusicThemes::MusicThemes(entt::registry& registry, MusicPlayer& musicPlayer)
+		:System(registry)
+		,mMusicPlayer(musicPlayer)
+	{
+	}
+
+	void MusicThemes::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::Damage, component::BodyRect>()
+		      .uses<MusicPlayer>();
+	}
+
+	void MusicThemes::update(float dt)
+	{
+		PH_PROFILE_FUNCTION();
+
+		if(ArcadeMode::isActive())
+			return;
+
+		// define constants
+		constexpr float distanceToEnemyToSwitchToAttackTheme = 270.f;
+		constexpr float distanceToEnemyToSwitchToExplorationTheme = 350.f;
+
+		// get player position
+		sf::Vector2f playerPos(-10000, -10000);
+		auto playerView = mRegistry.view<component::Player, component::BodyRect>();
+		playerView.each([&playerPos](const component::Player, const component::BodyRect& body) {
+			playerPos = body.rect.getCenter();
+		});
+
+		// get the closest enemy distance from player
+		float theClosestEnemyDistanceFromPlayer = 1000;
+		auto enemiesView = mRegistry.view<component::Damage, component::BodyRect>();
+		enemiesView.each([&theClosestEnemyDistanceFromPlayer, playerPos](const component::Damage, const component::BodyRect& body) 
+		{
+			const sf::Vector2f enemyPos = body.rect.getCenter();
+			const float enemyDistanceFromPlayer = Math::distanceBetweenPoints(enemyPos, playerPos);
+			if(theClosestEnemyDistanceFromPlayer > enemyDistanceFromPlayer)
+				theClosestEnemyDistanceFromPlayer = enemyDistanceFromPlayer;
+		});
+
+		// switch themes if they should be switched
+		Theme themeTypeWhichShouldBePlayed;
+		if(theClosestEnemyDistanceFromPlayer < distanceToEnemyToSwitchToAttackTheme)
+			themeTypeWhichShouldBePlayed = Theme::Fight;
+		else if(theClosestEnemyDistanceFromPlayer > distanceToEnemyToSwitchToExplorationTheme)
+			themeTypeWhichShouldBePlayed = Theme::Exploration;
+		else
+			themeTypeWhichShouldBePlayed = mCurrentlyPlayerTheme;
+
+		if(themeTypeWhichShouldBePlayed != mCurrentlyPlayerTheme) {
+			mCurrentlyPlayerTheme = themeTypeWhichShouldBePlayed;
+			if(mCurrentlyPlayerTheme == Theme::Fight)
+				mMusicPlayer.playFromMusicState("fight");
+			else
+				mMusicPlayer.playFromMusicState("exploration");
+		}
+	}
+}
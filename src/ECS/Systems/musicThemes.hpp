@@ -0,0 +1,26 @@
+#pragma once
+
+#include "ECS/system.hpp"
+
+namespace ph {
+	class MusicPlayer;
+}
+
+namespace ph::system {
+
+	// switches between exploration and fight music depending on distance from player to the closest enemy
+	class MusicThemes : public System
+	{
+	public:
+		MusicThemes(entt::registry& registry, MusicPlayer&);
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		MusicPlayer& mMusicPlayer;
+
+		enum class Theme { Exploration, Fight };
+		Theme mCurrentlyPlayerTheme = Theme::Exploration;
+	};
+}
@@ -1,22 +1,81 @@
 #include "particleSystem.hpp"
 #include "ECS/Components/particleComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
 #include "Utilities/random.hpp"
+#include "Utilities/cast.hpp"
 #include "Utilities/profiling.hpp"
 #include "Renderer/renderer.hpp"
-#include <cmath>
+#include "Renderer/API/camera.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+ph::FloatRect getParticlesBounds(const ph::component::ParticleEmitter& emi, const ph::component::BodyRect& body)
+{
+	// particles are spawned in spawn area and can't get further than the fastest initial velocity and acceleration take them in whole lifetime
+	const float t = emi.parWholeLifetime;
+	auto getTravelRange = [t](float velocity, float velocityRandom, float acceleration) {
+		const float travelByAcceleration = acceleration * t * t / 2.f;
+		return std::make_pair(std::min({velocity * t, velocityRandom * t, 0.f}) + std::min(travelByAcceleration, 0.f),
+		                      std::max({velocity * t, velocityRandom * t, 0.f}) + std::max(travelByAcceleration, 0.f));
+	};
+	const auto [minX, maxX] = getTravelRange(emi.parInitialVelocity.x, emi.parInitialVelocityRandom.x, emi.parAcceleration.x);
+	const auto [minY, maxY] = getTravelRange(emi.parInitialVelocity.y, emi.parInitialVelocityRandom.y, emi.parAcceleration.y);
+
+	// quads of centered particles begin half of their size before particle position
+	const sf::Vector2f spawnPosition = body.rect.getTopLeft() + emi.spawnPositionOffset;
+	return ph::FloatRect(spawnPosition.x + minX - emi.parSize.x, spawnPosition.y + minY - emi.parSize.y,
+	                     maxX - minX + emi.randomSpawnAreaSize.x + 2.f * emi.parSize.x,
+	                     maxY - minY + emi.randomSpawnAreaSize.y + 2.f * emi.parSize.y);
+}
+
+}
 
 namespace ph::system {
 
+PatricleSystem::PatricleSystem(entt::registry& registry)
+	:System(registry)
+{
+	// ranges of emitters are given back to the arena when emitters are removed or their entities are destroyed
+	mRegistry.on_destroy<component::ParticleEmitter>().connect<&PatricleSystem::freeParticleRangeOfEmitter>(*this);
+	mRegistry.on_destroy<component::MultiParticleEmitter>().connect<&PatricleSystem::freeParticleRangesOfMultiEmitter>(*this);
+}
+
+PatricleSystem::~PatricleSystem()
+{
+	mRegistry.on_destroy<component::ParticleEmitter>().disconnect(*this);
+	mRegistry.on_destroy<component::MultiParticleEmitter>().disconnect(*this);
+}
+
+void PatricleSystem::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::BodyRect, component::Camera>()
+	      .writes<component::ParticleEmitter, component::MultiParticleEmitter>()
+	      .submitsToRenderer();
+}
+
 void PatricleSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
+	findCameraBounds();
 	updateSingleParticleEmitters(dt);
 	updateMultiParticleEmitters(dt);
 }
 
-void PatricleSystem::updateSingleParticleEmitters(const float dt) const
+void PatricleSystem::findCameraBounds()
+{
+	mCameraBounds.reset();
+	auto cameras = mRegistry.view<component::Camera>();
+	cameras.each([this](const component::Camera& camera) {
+		if(camera.name == component::Camera::currentCameraName)
+			mCameraBounds = camera.camera.getBounds();
+	});
+}
+
+void PatricleSystem::updateSingleParticleEmitters(const float dt)
 {
 	auto view = mRegistry.view<component::ParticleEmitter, component::BodyRect>();
 	view.each([dt, this](component::ParticleEmitter& emi, const component::BodyRect& body)
@@ -25,7 +84,7 @@ void PatricleSystem::updateSingleParticleEmitters(const float dt) const
 	});
 }
 
-void PatricleSystem::updateMultiParticleEmitters(const float dt) const
+void PatricleSystem::updateMultiParticleEmitters(const float dt)
 {
 	auto view = mRegistry.view<component::MultiParticleEmitter, component::BodyRect>();
 	view.each([dt, this](component::MultiParticleEmitter& multiEmi, const component::BodyRect& body)
@@ -36,96 +95,110 @@ void PatricleSystem::updateMultiParticleEmitters(const float dt) const
 
 		// erase dead particle emitters from multi particle emitter
 		for(auto it = multiEmi.particleEmitters.begin(); it != multiEmi.particleEmitters.end();) {
-			if(it->oneShot && it->particles.empty())
+			if(it->oneShot && getNrOfParticles(*it) == 0) {
+				freeParticleRange(*it);
 				it = multiEmi.particleEmitters.erase(it);
+			}
 			else
 				++it;
 		}
 	});
 }
 
-void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEmitter& emi, const component::BodyRect& body) const
+void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEmitter& emi, const component::BodyRect& body)
 {
 	// exit if is not emitting
 	if(!emi.isEmitting)
 		return;
 
 	// alocate particles
-	if(!emi.wasInitialized) {
-		emi.particles.reserve(emi.amountOfParticles);
-		emi.wasInitialized = true;
-	}
+	if(emi.particleRange == ParticleArena::sNullRange)
+		emi.particleRange = mParticleArena.allocateRange(emi.amountOfParticles);
+
+	// kill particles, they die in the order they were spawned so it doesn't move other particles
+	mParticleArena.killOldParticles(emi.particleRange, emi.parWholeLifetime);
+
+	spawnParticles(emi, body);
+
+	mParticleArena.update(emi.particleRange, dt, emi.parAcceleration, Cast::toNormalizedColorVector4f(emi.parStartColor),
+	                      Cast::toNormalizedColorVector4f(emi.parEndColor), emi.parWholeLifetime);
+
+	if(mCameraBounds && !mCameraBounds->doPositiveRectsIntersect(getParticlesBounds(emi, body)))
+		return;
 
-	// erase particles
-	while(!emi.particles.empty() && emi.particles.front().lifetime >= emi.parWholeLifetime)
-		emi.particles.erase(emi.particles.begin());
+	// submit particles to renderer, particles without texture which are squares are centered on their positions
+	mQuads.clear();
+	const bool isCentered = !emi.parTexture && emi.parSize.x == emi.parSize.y;
+	const sf::Vector2f positionOffset = isCentered ? -emi.parSize / 2.f : sf::Vector2f(0.f, 0.f);
+	mParticleArena.appendQuads(emi.particleRange, positionOffset, emi.parSize, mQuads);
+	if(!mQuads.empty())
+		Renderer::submitBunchOfQuadsWithTheSameTexture(mQuads.data(), mQuads.size(), emi.parTexture, nullptr, emi.parZ);
+}
 
-	// add particles
-	if(!emi.oneShot || emi.amountOfAlreadySpawnParticles < emi.amountOfParticles)
+void PatricleSystem::spawnParticles(component::ParticleEmitter& emi, const component::BodyRect& body)
+{
+	if(emi.oneShot && emi.amountOfAlreadySpawnParticles >= emi.amountOfParticles)
+		return;
+
+	auto addParticle = [this](component::ParticleEmitter& emi, const component::BodyRect& body) 
 	{
-		auto addParticle = [](component::ParticleEmitter& emi, const component::BodyRect& body) 
-		{
-			Particle particle;
+		sf::Vector2f position = body.rect.getTopLeft() + emi.spawnPositionOffset;
 
-			particle.position = body.rect.getTopLeft() + emi.spawnPositionOffset;
+		if(emi.randomSpawnAreaSize != sf::Vector2f(0.f, 0.f))
+			position += Random::generateVector({0.f, 0.f}, emi.randomSpawnAreaSize);
 
-			if(emi.randomSpawnAreaSize != sf::Vector2f(0.f, 0.f))
-				particle.position += Random::generateVector({0.f, 0.f}, emi.randomSpawnAreaSize);
+		sf::Vector2f velocity = emi.parInitialVelocity;
+		if(emi.parInitialVelocity != emi.parInitialVelocityRandom)
+			velocity = Random::generateVector(emi.parInitialVelocity, emi.parInitialVelocityRandom);
 
-			if(emi.parInitialVelocity == emi.parInitialVelocityRandom)
-				particle.velocity = emi.parInitialVelocity;
-			else
-				particle.velocity = Random::generateVector(emi.parInitialVelocity, emi.parInitialVelocityRandom);
-				
-			emi.particles.emplace_back(particle);
-		};
+		mParticleArena.spawn(emi.particleRange, position, velocity);
+	};
 
-		if(emi.oneShot || static_cast<float>(emi.amountOfParticles) > emi.parWholeLifetime * 60.f)
-		{
-			float nrOfParticlesPerFrame = float(emi.amountOfParticles / unsigned(emi.parWholeLifetime * 60.f));
-			unsigned nrOfParticlesAddedInThisFrame = 0;
-			while((emi.particles.size() < emi.amountOfParticles) && 
-				    (emi.oneShot || nrOfParticlesAddedInThisFrame < nrOfParticlesPerFrame))
-			{
-				++nrOfParticlesAddedInThisFrame;
-				addParticle(emi, body);
-			}
-			emi.amountOfAlreadySpawnParticles += nrOfParticlesAddedInThisFrame;
-		}
-		else if((emi.particles.size() < emi.amountOfParticles) && 
-			(emi.particles.empty() || emi.particles.back().lifetime > emi.parWholeLifetime / emi.amountOfParticles))
+	const unsigned nrOfParticles = getNrOfParticles(emi);
+	if(emi.oneShot || static_cast<float>(emi.amountOfParticles) > emi.parWholeLifetime * 60.f)
+	{
+		float nrOfParticlesPerFrame = float(emi.amountOfParticles / unsigned(emi.parWholeLifetime * 60.f));
+		unsigned nrOfParticlesAddedInThisFrame = 0;
+		while((nrOfParticles + nrOfParticlesAddedInThisFrame < emi.amountOfParticles) && 
+			    (emi.oneShot || nrOfParticlesAddedInThisFrame < nrOfParticlesPerFrame))
 		{
+			++nrOfParticlesAddedInThisFrame;
 			addParticle(emi, body);
-			++emi.amountOfAlreadySpawnParticles;
 		}
+		emi.amountOfAlreadySpawnParticles += nrOfParticlesAddedInThisFrame;
 	}
-
-	for(auto& particle : emi.particles)
+	else if((nrOfParticles < emi.amountOfParticles) && 
+		(nrOfParticles == 0 || mParticleArena.getLifetimeOfNewestParticle(emi.particleRange) > emi.parWholeLifetime / emi.amountOfParticles))
 	{
-		// update particle
-		particle.lifetime += dt;
-		particle.velocity += emi.parAcceleration * dt;
-		particle.position += particle.velocity * dt;
-
-		// compute current particle color
-		sf::Color color = emi.parStartColor;
-		if(emi.parStartColor != emi.parEndColor) {
-			const float startColorMultiplier = (emi.parWholeLifetime - particle.lifetime) / emi.parWholeLifetime;
-			const float endColorMultiplier = particle.lifetime / emi.parWholeLifetime;
-			color.r = unsigned char(float(emi.parStartColor.r) * startColorMultiplier + float(emi.parEndColor.r) * endColorMultiplier);
-			color.g = unsigned char(float(emi.parStartColor.g) * startColorMultiplier + float(emi.parEndColor.g) * endColorMultiplier);
-			color.b = unsigned char(float(emi.parStartColor.b) * startColorMultiplier + float(emi.parEndColor.b) * endColorMultiplier);
-			color.a = unsigned char(float(emi.parStartColor.a) * startColorMultiplier + float(emi.parEndColor.a) * endColorMultiplier);
-		}
+		addParticle(emi, body);
+		++emi.amountOfAlreadySpawnParticles;
+	}
+}
+
+unsigned PatricleSystem::getNrOfParticles(const component::ParticleEmitter& emi) const
+{
+	if(emi.particleRange == ParticleArena::sNullRange)
+		return 0;
+	return mParticleArena.getNrOfParticles(emi.particleRange);
+}
 
-		// submit particle to renderer
-		if(emi.parTexture)
-			Renderer::submitQuad(emi.parTexture, nullptr, &color, nullptr, particle.position, emi.parSize, emi.parZ, 0.f, {});
-		else if(emi.parSize.x != emi.parSize.y)
-			Renderer::submitQuad(nullptr, nullptr, &color, nullptr, particle.position, emi.parSize, emi.parZ, 0.f, {});
-		else
-			Renderer::submitPoint(particle.position, color, emi.parZ, emi.parSize.x);
+void PatricleSystem::freeParticleRange(component::ParticleEmitter& emi)
+{
+	if(emi.particleRange != ParticleArena::sNullRange) {
+		mParticleArena.freeRange(emi.particleRange);
+		emi.particleRange = ParticleArena::sNullRange;
 	}
 }
 
+void PatricleSystem::freeParticleRangeOfEmitter(entt::entity entity)
+{
+	freeParticleRange(mRegistry.get<component::ParticleEmitter>(entity));
+}
+
+void PatricleSystem::freeParticleRangesOfMultiEmitter(entt::entity entity)
+{
+	for(auto& particleEmitter : mRegistry.get<component::MultiParticleEmitter>(entity).particleEmitters)
+		freeParticleRange(particleEmitter);
+}
+
 }
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "ECS/particleArena.hpp"
+#include "Utilities/rect.hpp"
+#include <optional>
+#include <vector>
 
 namespace ph::component {
 	struct ParticleEmitter;
@@ -9,17 +13,35 @@ namespace ph::component {
 
 namespace ph::system {
 
+// particles of all emitters are kept in one arena, particles of every emitter are submitted to renderer as one bunch of quads
 class PatricleSystem : public System
 {
 public:
-	using System::System;
+	PatricleSystem(entt::registry&);
+	~PatricleSystem();
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
+
+	const ParticleArena& getParticleArena() const { return mParticleArena; }
+
+private:
+	void findCameraBounds();
+	void updateSingleParticleEmitters(const float dt);
+	void updateMultiParticleEmitters(const float dt);
+	void updateParticleEmitter(const float dt, ph::component::ParticleEmitter&, const ph::component::BodyRect&);
+	void spawnParticles(ph::component::ParticleEmitter&, const ph::component::BodyRect&);
+	unsigned getNrOfParticles(const ph::component::ParticleEmitter&) const;
+
+	void freeParticleRange(ph::component::ParticleEmitter&);
+	void freeParticleRangeOfEmitter(entt::entity);
+	void freeParticleRangesOfMultiEmitter(entt::entity);
 
 private:
-	void updateSingleParticleEmitters(const float dt) const;
-	void updateMultiParticleEmitters(const float dt) const;
-	void updateParticleEmitter(const float dt, ph::component::ParticleEmitter&, const ph::component::BodyRect&) const;
+	ParticleArena mParticleArena;
+	std::vector<QuadData> mQuads;
+	// bunches of quads aren't culled by renderer, so emitters which particles can't reach the screen aren't submitted
+	std::optional<FloatRect> mCameraBounds;
 };
 
 }
\ No newline at end of file
@@ -2,10 +2,20 @@
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/itemComponents.hpp"
+#include "ECS/spatialHash.hpp"
+#include "ECS/events.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 
+	void PickupItems::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::Medkit, component::BulletBox, component::BodyRect>()
+		      .writes<component::Health, component::Bullets>()
+		      .emits<event::Destroy>()
+		      .usesReadOnly<SpatialHash>();
+	}
+
 	void PickupItems::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
@@ -13,14 +23,21 @@ namespace ph::system {
 		auto players = mRegistry.view<component::Player, component::BodyRect, component::Health, component::Bullets>();
 		auto medkits = mRegistry.view<component::Medkit, component::BodyRect>();
 		auto bulletBoxes = mRegistry.view<component::BulletBox, component::Bullets, component::BodyRect>();
+		const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+		auto& destroyEvents = mRegistry.ctx<EventQueue<event::Destroy>>();
+		std::vector<entt::entity> nearbyItems;
 
 		for (auto player : players)
 		{
 			const auto& playerBody  = players.get<component::BodyRect>(player);
 			auto& [playerHealth, playerBullets] = players.get<component::Health, component::Bullets>(player);
+			spatialHash.queryRect(playerBody.rect, nearbyItems);
 			
-			for (auto medkitEntity : medkits)
+			for (auto medkitEntity : nearbyItems)
 			{
+				if (!medkits.contains(medkitEntity))
+					continue;
+
 				const auto& [medkit, medkitBody] = medkits.get<component::Medkit, component::BodyRect>(medkitEntity);
 
 				if (playerBody.rect.doPositiveRectsIntersect(medkitBody.rect)) {
@@ -28,18 +45,23 @@ namespace ph::system {
 						playerHealth.healthPoints += medkit.addHealthPoints;
 					else
 						playerHealth.healthPoints = playerHealth.maxHealthPoints;
-					mRegistry.assign<component::TaggedToDestroy>(medkitEntity);
+					mRegistry.replace<component::Health>(player, playerHealth);
+					destroyEvents.emit(medkitEntity);
 				}
 			}
 
-			for (auto bulletBoxEntity : bulletBoxes)
+			for (auto bulletBoxEntity : nearbyItems)
 			{
+				if (!bulletBoxes.contains(bulletBoxEntity))
+					continue;
+
 				const auto& [bulletBoxBullets, bulletBoxBody] = bulletBoxes.get<component::Bullets, component::BodyRect>(bulletBoxEntity);
 
 				if (playerBody.rect.doPositiveRectsIntersect(bulletBoxBody.rect)) {
 					playerBullets.numOfPistolBullets += bulletBoxBullets.numOfPistolBullets;
 					playerBullets.numOfShotgunBullets += bulletBoxBullets.numOfShotgunBullets;
-					mRegistry.assign<component::TaggedToDestroy>(bulletBoxEntity);
+					mRegistry.replace<component::Bullets>(player, playerBullets);
+					destroyEvents.emit(bulletBoxEntity);
 				}
 			}
 		}
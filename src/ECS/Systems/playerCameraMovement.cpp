@@ -1,7 +1,9 @@
 #include "playerCameraMovement.hpp"
+#include "bodyRectsSnapshot.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/systemsQueue.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
@@ -11,11 +13,20 @@ PlayerCameraMovement::PlayerCameraMovement(entt::registry& registry)
 {
 }
 
+void PlayerCameraMovement::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Player, component::BodyRect, component::PreviousBodyRect>()
+	      .writes<component::Camera>();
+}
+
 void PlayerCameraMovement::update(float dt)
 {
+	// camera follows the same interpolated position at which RenderSystem draws the player, so the player doesn't jitter on the screen
+	const float factor = mRegistry.ctx<FixedStepInterpolation>().factor;
 	auto view = mRegistry.view<component::Player, component::Camera, component::BodyRect>();
-	view.each([dt](const component::Player, component::Camera& camera, const component::BodyRect& bodyRect) {
-		camera.camera.setCenterSmoothly(bodyRect.rect.getCenter(), 4 * dt);
+	view.each([this, dt, factor](entt::entity player, const component::Player, component::Camera& camera, const component::BodyRect& bodyRect) {
+		const sf::Vector2f center = BodyRectsSnapshot::getInterpolatedPosition(mRegistry, player, bodyRect.rect, factor) + bodyRect.rect.getSize() / 2.f;
+		camera.camera.setCenterSmoothly(center, 4 * dt);
 	});
 }
 
@@ -10,6 +10,7 @@ public:
 	PlayerCameraMovement(entt::registry& registry);
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 };
 
 }
@@ -21,6 +21,14 @@ namespace ph::system {
 	{
 	}
 
+	void PlayerMovementInput::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::Player, component::DeadCharacter, component::CharacterSpeed, component::BodyRect>()
+		      .writes<component::Velocity, component::AnimationData, component::FaceDirection, component::LightSource>()
+		      .uses<AIManager, ActionEventManager>()
+		      .receivesActions<ActionId::PauseScreen>();
+	}
+
 	void PlayerMovementInput::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
@@ -51,7 +59,7 @@ namespace ph::system {
 		if(event.mType == ActionEvent::Type::Pressed)
 		{
 			// TODO_states: Pause screen could be handled by states
-			if(event.mAction == "pauseScreen") 
+			if(event.mAction == ActionId::PauseScreen) 
 			{
 				auto players = mRegistry.view<component::Player, component::Health>();
 				players.each([this](component::Player, component::Health) {
@@ -73,10 +81,10 @@ namespace ph::system {
 
 	void PlayerMovementInput::updateInputFlags()
 	{
-		mUp    = ActionEventManager::isActionPressed("movingUp");
-		mDown  = ActionEventManager::isActionPressed("movingDown");
-		mLeft  = ActionEventManager::isActionPressed("movingLeft");
-		mRight = ActionEventManager::isActionPressed("movingRight");
+		mUp    = ActionEventManager::isActionPressed(ActionId::MovingUp);
+		mDown  = ActionEventManager::isActionPressed(ActionId::MovingDown);
+		mLeft  = ActionEventManager::isActionPressed(ActionId::MovingLeft);
+		mRight = ActionEventManager::isActionPressed(ActionId::MovingRight);
 	}
 
 	void PlayerMovementInput::updateAnimationData()
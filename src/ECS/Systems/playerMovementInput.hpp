@@ -17,6 +17,7 @@ namespace system {
 		PlayerMovementInput(entt::registry&, AIManager&, GUI& gui, Scene*);
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 		void onEvent(const ActionEvent& event) override;
 
 	private:
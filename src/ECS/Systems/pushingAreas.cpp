@@ -2,24 +2,38 @@
 
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
 
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 
+void PushingAreas::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::PushingArea, component::BodyRect>()
+	      .writes<component::Velocity>()
+	      .usesReadOnly<SpatialHash>();
+}
+
 void PushingAreas::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
 	auto pushingAreasView = mRegistry.view<component::PushingArea, component::BodyRect>();
 	auto kinematicObjects = mRegistry.view<component::BodyRect, component::Velocity>();
+	const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+	std::vector<entt::entity> objectsInArea;
 
 	for (auto pushingArea : pushingAreasView)
 	{
 		const auto& [pushingAreaDetails, areaBody] = pushingAreasView.get<component::PushingArea, component::BodyRect>(pushingArea);
 
-		for (auto kinematicObject : kinematicObjects)
+		spatialHash.queryRect(areaBody.rect, objectsInArea);
+		for (auto kinematicObject : objectsInArea)
 		{
+			if (!kinematicObjects.contains(kinematicObject))
+				continue;
+
 			auto& objectVelocity = kinematicObjects.get<component::Velocity>(kinematicObject);
 			const auto& kinematicObjectBody = kinematicObjects.get<component::BodyRect>(kinematicObject);
 			if (areaBody.rect.contains(kinematicObjectBody.rect.getCenter()))
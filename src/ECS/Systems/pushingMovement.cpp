@@ -3,9 +3,15 @@
 
 namespace ph::system {
 
+	void PushingMovement::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::KinematicCollisionBody, component::Sleeping>()
+		      .writes<component::PushingForces, component::BodyRect>();
+	}
+
 	void PushingMovement::update(float dt)
 	{
-		auto view = mRegistry.view<component::PushingForces, component::KinematicCollisionBody, component::BodyRect>();
+		auto view = mRegistry.view<component::PushingForces, component::KinematicCollisionBody, component::BodyRect>(entt::exclude<component::Sleeping>);
 		view.each([dt](component::PushingForces& pf, const component::KinematicCollisionBody kinematicCollisionBody, component::BodyRect& body)
 		{
 			// move body
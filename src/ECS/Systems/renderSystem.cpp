@@ -1,9 +1,12 @@
 #include "renderSystem.hpp"
+#include "bodyRectsSnapshot.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "Renderer/renderer.hpp"
 #include "Renderer/API/camera.hpp"
+#include "ECS/systemsQueue.hpp"
+#include "ECS/registryGroups.hpp"
 #include "Logs/logs.hpp"
 #include "Utilities/profiling.hpp"
 #include <entt/entity/utility.hpp>
@@ -21,6 +24,14 @@ RenderSystem::RenderSystem(entt::registry& registry, Texture& tileset)
 {
 }
 
+void RenderSystem::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::Camera, component::LightSource, component::LightWall, component::RenderChunk,
+	             component::RenderQuad, component::TextureRect, component::HiddenForRenderer, component::BodyRect,
+	             component::PreviousBodyRect>()
+	      .beginsRendererScene();
+}
+
 void RenderSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -36,12 +47,15 @@ void RenderSystem::update(float dt)
 	// begin scene
 	Renderer::beginScene(*currentCamera);
 
+	// entities are drawn between their two last fixed step positions, so their movement is smooth at any frame rate
+	const float factor = mRegistry.ctx<FixedStepInterpolation>().factor;
+
 	// submit light sources
 	auto lightSources = mRegistry.view<component::LightSource, component::BodyRect>();
-	lightSources.each([](const component::LightSource& pointLight, const component::BodyRect& body)
+	lightSources.each([this, factor](entt::entity entity, const component::LightSource& pointLight, const component::BodyRect& body)
 	{
 		PH_ASSERT_UNEXPECTED_SITUATION(pointLight.startAngle <= pointLight.endAngle, "start angle must be lesser or equal to end angle");
-		Renderer::submitLight(pointLight.color, body.rect.getTopLeft() + pointLight.offset, pointLight.startAngle, pointLight.endAngle,
+		Renderer::submitLight(pointLight.color, BodyRectsSnapshot::getInterpolatedPosition(mRegistry, entity, body.rect, factor) + pointLight.offset, pointLight.startAngle, pointLight.endAngle,
 			pointLight.attenuationAddition, pointLight.attenuationFactor, pointLight.attenuationSquareFactor);
 	});
 
@@ -63,22 +77,14 @@ void RenderSystem::update(float dt)
 			Renderer::submitBunchOfQuadsWithTheSameTexture(chunk.quads, &mTilesetTexture, nullptr, chunk.z);
 	});
 
-	// submit render quads
-	auto renderQuads = mRegistry.view<component::RenderQuad, component::BodyRect>(entt::exclude<component::HiddenForRenderer, component::TextureRect>);
-	renderQuads.each([](const component::RenderQuad& quad, const component::BodyRect& body)
-	{
-		Renderer::submitQuad(
-			quad.texture, nullptr, &quad.color, quad.shader,
-			body.rect.getTopLeft(), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
-	});
-	
-	// submit render quads with texture rect
-	auto renderQuadsWithTextureRect = mRegistry.view<component::RenderQuad, component::TextureRect, component::BodyRect>(entt::exclude<component::HiddenForRenderer>);
-	renderQuadsWithTextureRect.each([](const component::RenderQuad& quad, const component::TextureRect& textureRect, const component::BodyRect& body)
+	// submit render quads, renderer sorts them, so quads with and without texture rect are submitted in one loop
+	auto textureRects = mRegistry.view<component::TextureRect>();
+	Groups::renderQuads(mRegistry).each([this, factor, textureRects](entt::entity entity, const component::RenderQuad& quad, const component::BodyRect& body)
 	{
+		const IntRect* textureRect = textureRects.contains(entity) ? &textureRects.get(entity).rect : nullptr;
 		Renderer::submitQuad(
-			quad.texture, &textureRect.rect, &quad.color, quad.shader,
-			body.rect.getTopLeft(), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
+			quad.texture, textureRect, &quad.color, quad.shader,
+			BodyRectsSnapshot::getInterpolatedPosition(mRegistry, entity, body.rect, factor), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
 	});
 }
 
@@ -16,6 +16,7 @@ public:
 	RenderSystem(entt::registry& registry, Texture& tileset);
 
 	void update(float dt) override;
+	void declareAccess(SystemAccess&) const override;
 
 private:
 	Texture& mTilesetTexture;
@@ -0,0 +1,117 @@
+#include "sleepingBodies.hpp"
+#include "ECS/Components/objectsComponents.hpp"
+#include "ECS/spatialHash.hpp"
+#include "Utilities/profiling.hpp"
+
+namespace ph::system {
+
+	SleepingBodies::SleepingBodies(entt::registry& registry, float timeToFallAsleep)
+		:System(registry)
+		,mTimeToFallAsleep(timeToFallAsleep)
+	{
+		// closed gate can appear on a sleeping body and StaticCollisions doesn't see sleeping bodies,
+		// system which assigns static body doesn't write sleeping bodies, so they are woken in update
+		mRegistry.on_construct<component::StaticCollisionBody>().connect<&SleepingBodies::recordNewStaticBody>(*this);
+	}
+
+	SleepingBodies::~SleepingBodies()
+	{
+		mRegistry.on_construct<component::StaticCollisionBody>().disconnect(*this);
+	}
+
+	void SleepingBodies::declareAccess(SystemAccess& access) const
+	{
+		// bodies which fall asleep or wake up are moved in pools owned by groups of moving bodies
+		// reading StaticCollisionBody keeps systems which assign it from running in parallel with recordNewStaticBody()
+		access.reads<component::PushingForces, component::Car, component::StaticCollisionBody>()
+		      .writes<component::BodyRect, component::Velocity, component::KinematicCollisionBody, component::Sleeping>()
+		      .usesReadOnly<SpatialHash>();
+	}
+
+	void SleepingBodies::update(float dt)
+	{
+		PH_PROFILE_FUNCTION();
+
+		auto sleepingBodies = mRegistry.view<component::Sleeping, component::Velocity, component::KinematicCollisionBody>();
+		auto awakeBodies = mRegistry.view<component::BodyRect, component::Velocity, component::KinematicCollisionBody>(entt::exclude<component::Sleeping>);
+		auto cars = mRegistry.view<component::Car, component::BodyRect>();
+
+		// velocity was written by input, ai or area
+		for (auto sleepingBody : sleepingBodies)
+		{
+			if (isMoving(sleepingBody))
+				mBodiesToWake.emplace_back(sleepingBody);
+		}
+
+		for (auto awakeBody : awakeBodies)
+		{
+			auto& kinematicCollision = awakeBodies.get<component::KinematicCollisionBody>(awakeBody);
+			if (isMoving(awakeBody))
+			{
+				kinematicCollision.timeAtRest = 0.f;
+				findSleepingBodiesTouchedBy(awakeBodies.get<component::BodyRect>(awakeBody).rect);
+			}
+			else
+			{
+				kinematicCollision.timeAtRest += dt;
+				if (kinematicCollision.timeAtRest >= mTimeToFallAsleep)
+					mBodiesToFallAsleep.emplace_back(awakeBody);
+			}
+		}
+
+		for (auto staticBody : mNewStaticBodies)
+		{
+			if (mRegistry.valid(staticBody) && mRegistry.has<component::StaticCollisionBody, component::BodyRect>(staticBody))
+				findSleepingBodiesTouchedBy(mRegistry.get<component::BodyRect>(staticBody).rect);
+		}
+		mNewStaticBodies.clear();
+
+		// cars are static bodies which move
+		for (auto car : cars)
+		{
+			if (cars.get<component::Car>(car).velocity > 0.f)
+				findSleepingBodiesTouchedBy(cars.get<component::BodyRect>(car).rect);
+		}
+
+		for (auto body : mBodiesToWake)
+		{
+			if (mRegistry.has<component::Sleeping>(body))
+			{
+				mRegistry.remove<component::Sleeping>(body);
+				mRegistry.get<component::KinematicCollisionBody>(body).timeAtRest = 0.f;
+			}
+		}
+		for (auto body : mBodiesToFallAsleep)
+			mRegistry.assign<component::Sleeping>(body);
+
+		mBodiesToWake.clear();
+		mBodiesToFallAsleep.clear();
+	}
+
+	bool SleepingBodies::isMoving(entt::entity entity) const
+	{
+		const auto& vel = mRegistry.get<component::Velocity>(entity);
+		if (vel.dx != 0.f || vel.dy != 0.f)
+			return true;
+
+		const auto* pushingForces = mRegistry.try_get<component::PushingForces>(entity);
+		return pushingForces && pushingForces->vel != sf::Vector2f(0.f, 0.f);
+	}
+
+	void SleepingBodies::findSleepingBodiesTouchedBy(const FloatRect& rect)
+	{
+		auto sleepingBodies = mRegistry.view<component::Sleeping, component::BodyRect, component::KinematicCollisionBody>();
+
+		mRegistry.ctx<SpatialHash>().queryRect(rect, mNearbyObjects);
+		for (auto nearbyObject : mNearbyObjects)
+		{
+			if (sleepingBodies.contains(nearbyObject) && rect.doPositiveRectsIntersect(sleepingBodies.get<component::BodyRect>(nearbyObject).rect))
+				mBodiesToWake.emplace_back(nearbyObject);
+		}
+	}
+
+	void SleepingBodies::recordNewStaticBody(entt::entity entity)
+	{
+		mNewStaticBodies.emplace_back(entity);
+	}
+}
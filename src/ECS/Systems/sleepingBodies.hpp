@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ECS/system.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+
+namespace ph::system {
+
+	// puts kinematic bodies which don't move to sleep and wakes them when they get velocity,
+	// are pushed or something touches them, should be run after all systems which write Velocity and before Movement
+	class SleepingBodies : public System
+	{
+	public:
+		SleepingBodies(entt::registry& registry, float timeToFallAsleep = 1.f);
+		~SleepingBodies();
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		bool isMoving(entt::entity) const;
+		void findSleepingBodiesTouchedBy(const FloatRect&);
+
+		void recordNewStaticBody(entt::entity);
+
+	private:
+		std::vector<entt::entity> mNearbyObjects;
+		// static bodies which appeared since the last update, bodies under them are woken in update
+		std::vector<entt::entity> mNewStaticBodies;
+		std::vector<entt::entity> mBodiesToWake;
+		std::vector<entt::entity> mBodiesToFallAsleep;
+		const float mTimeToFallAsleep;
+	};
+}
@@ -0,0 +1,46 @@
+#include "spatialHashUpdate.hpp"
+#include "ECS/spatialHash.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "Utilities/profiling.hpp"
+
+namespace ph::system {
+
+	SpatialHashUpdate::SpatialHashUpdate(entt::registry& registry)
+		:System(registry)
+	{
+		mRegistry.set<SpatialHash>();
+
+		// destroyed entities are removed at once, so other systems never get them from queries
+		mRegistry.on_destroy<component::BodyRect>().connect<&SpatialHashUpdate::removeFromSpatialHash>();
+		mRegistry.on_destroy<component::MultiStaticCollisionBody>().connect<&SpatialHashUpdate::removeFromSpatialHash>();
+	}
+
+	void SpatialHashUpdate::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::BodyRect, component::MultiStaticCollisionBody>()
+		      .uses<SpatialHash>();
+	}
+
+	void SpatialHashUpdate::update(float dt)
+	{
+		PH_PROFILE_FUNCTION();
+
+		auto& spatialHash = mRegistry.ctx<SpatialHash>();
+
+		mRegistry.view<component::BodyRect>().each([&spatialHash](entt::entity entity, const component::BodyRect& body) {
+			spatialHash.insertOrUpdate(entity, body.rect);
+		});
+
+		// map chunks don't have BodyRect, they're put into the hash with bounds of all their rects
+		mRegistry.view<component::MultiStaticCollisionBody>(entt::exclude<component::BodyRect>).each(
+			[&spatialHash](entt::entity entity, const component::MultiStaticCollisionBody& multiStaticBody) {
+				spatialHash.insertOrUpdate(entity, multiStaticBody.sharedBounds);
+		});
+	}
+
+	void SpatialHashUpdate::removeFromSpatialHash(entt::entity entity, entt::registry& registry)
+	{
+		if(auto* spatialHash = registry.try_ctx<SpatialHash>())
+			spatialHash->remove(entity);
+	}
+}
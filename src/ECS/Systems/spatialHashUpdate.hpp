@@ -0,0 +1,19 @@
+#pragma once
+
+#include "ECS/system.hpp"
+
+namespace ph::system {
+
+	// keeps SpatialHash context variable in sync with BodyRects, should be the first fixed step system
+	class SpatialHashUpdate : public System
+	{
+	public:
+		SpatialHashUpdate(entt::registry& registry);
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		static void removeFromSpatialHash(entt::entity, entt::registry&);
+	};
+}
@@ -1,17 +1,80 @@
 #include "staticCollisions.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
 #include "Utilities/profiling.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+void resolveStaticCollision(ph::FloatRect& kinematicRect, const ph::FloatRect& staticRect, ph::component::KinematicCollisionBody& kinematicCollision)
+{
+	if(!kinematicRect.doPositiveRectsIntersect(staticRect))
+		return;
+
+	sf::FloatRect intersection;
+	kinematicRect.intersects(staticRect, intersection);
+
+	if(intersection.width < intersection.height)
+	{
+		if(kinematicRect.left < staticRect.left)
+			kinematicRect.left -= intersection.width;
+		else
+			kinematicRect.left += intersection.width;
+
+		kinematicCollision.staticallyMovedByX = true;
+	}
+	else
+	{
+		if(kinematicRect.top < staticRect.top)
+			kinematicRect.top -= intersection.height;
+		else
+			kinematicRect.top += intersection.height;
+
+		kinematicCollision.staticallyMovedByY = true;
+	}
+}
+
+void resolveTileCollisions(ph::FloatRect& kinematicRect, const ph::component::TileCollisionBitmap& bitmap,
+                           ph::component::KinematicCollisionBody& kinematicCollision)
+{
+	// only tiles which body overlaps are visited
+	const int left = std::max(static_cast<int>(std::floor(kinematicRect.left / bitmap.tileSize.x)), 0);
+	const int top = std::max(static_cast<int>(std::floor(kinematicRect.top / bitmap.tileSize.y)), 0);
+	const int right = std::min(static_cast<int>(std::ceil(kinematicRect.right() / bitmap.tileSize.x)), static_cast<int>(bitmap.mapSize.x));
+	const int bottom = std::min(static_cast<int>(std::ceil(kinematicRect.bottom() / bitmap.tileSize.y)), static_cast<int>(bitmap.mapSize.y));
+
+	for(int y = top; y < bottom; ++y)
+		for(int x = left; x < right; ++x)
+			if(bitmap.isSolid(x, y))
+			{
+				const ph::FloatRect tileRect(x * bitmap.tileSize.x, y * bitmap.tileSize.y, bitmap.tileSize.x, bitmap.tileSize.y);
+				resolveStaticCollision(kinematicRect, tileRect, kinematicCollision);
+			}
+}
+
+}
 
 namespace ph::system {
 
+	void StaticCollisions::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::StaticCollisionBody, component::MultiStaticCollisionBody, component::TileCollisionBitmap, component::Sleeping>()
+		      .writes<component::BodyRect, component::KinematicCollisionBody>()
+		      .usesReadOnly<SpatialHash>();
+	}
+
 	void StaticCollisions::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
+		auto collisionBitmaps = mRegistry.view<component::TileCollisionBitmap>();
 		auto staticObjects = mRegistry.view<component::BodyRect, component::StaticCollisionBody>();
 		auto multiStaticCollisionObjects = mRegistry.view<component::MultiStaticCollisionBody>();
-		auto kinematicObjects = mRegistry.view<component::BodyRect, component::KinematicCollisionBody>();
-		
+		auto kinematicObjects = mRegistry.view<component::BodyRect, component::KinematicCollisionBody>(entt::exclude<component::Sleeping>);
+		const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+		std::vector<entt::entity> nearbyObjects;
+
 		for (auto& kinematicObject : kinematicObjects)
 		{
 			auto& kinematicBody = kinematicObjects.get<component::BodyRect>(kinematicObject);
@@ -19,70 +82,30 @@ namespace ph::system {
 			kinematicCollision.staticallyMovedByX = false;
 			kinematicCollision.staticallyMovedByY = false;
 
+			// compute collisions with whole tiles of the map
+			for (auto collisionBitmap : collisionBitmaps)
+				resolveTileCollisions(kinematicBody.rect, collisionBitmaps.get(collisionBitmap), kinematicCollision);
+
+			spatialHash.queryRect(kinematicBody.rect, nearbyObjects);
+
 			// compute single static collisions
-			for (const auto& staticObject : staticObjects)
+			for (const auto& staticObject : nearbyObjects)
 			{
-				const auto& staticBody = staticObjects.get<component::BodyRect>(staticObject);
-				
-				if (kinematicBody.rect.doPositiveRectsIntersect(staticBody.rect))
-				{
-					sf::FloatRect intersection;
-					kinematicBody.rect.intersects(staticBody.rect, intersection);
-
-					if (intersection.width < intersection.height)
-					{
-						if (kinematicBody.rect.left < staticBody.rect.left)
-							kinematicBody.rect.left -= intersection.width;
-						else
-							kinematicBody.rect.left += intersection.width;
-
-						kinematicCollision.staticallyMovedByX = true;
-					}
-					else
-					{
-						if (kinematicBody.rect.top < staticBody.rect.top)
-							kinematicBody.rect.top -= intersection.height;
-						else
-							kinematicBody.rect.top += intersection.height;
-
-						kinematicCollision.staticallyMovedByY = true;
-					}
-				}
+				if (staticObjects.contains(staticObject))
+					resolveStaticCollision(kinematicBody.rect, staticObjects.get<component::BodyRect>(staticObject).rect, kinematicCollision);
 			}
-		
-			// compute multi static collisions
-			for(const auto& multiStaticObject : multiStaticCollisionObjects)
+
+			// compute multi static collisions, these are parts of tiles which aren't in the collision bitmap
+			for(const auto& multiStaticObject : nearbyObjects)
 			{
-				const auto& multiStaticCollisionBody = mRegistry.get<component::MultiStaticCollisionBody>(multiStaticObject);
+				if(!multiStaticCollisionObjects.contains(multiStaticObject))
+					continue;
+
+				const auto& multiStaticCollisionBody = multiStaticCollisionObjects.get(multiStaticObject);
 				if(multiStaticCollisionBody.sharedBounds.doPositiveRectsIntersect(kinematicBody.rect))
 				{
 					for(const FloatRect& staticCollisionBodyRect : multiStaticCollisionBody.rects)
-					{
-						if(kinematicBody.rect.doPositiveRectsIntersect(staticCollisionBodyRect))
-						{
-							sf::FloatRect intersection;
-							kinematicBody.rect.intersects(staticCollisionBodyRect, intersection);
-
-							if(intersection.width < intersection.height)
-							{
-								if(kinematicBody.rect.left < staticCollisionBodyRect.left)
-									kinematicBody.rect.left -= intersection.width;
-								else
-									kinematicBody.rect.left += intersection.width;
-
-								kinematicCollision.staticallyMovedByX = true;
-							}
-							else
-							{
-								if(kinematicBody.rect.top < staticCollisionBodyRect.top)
-									kinematicBody.rect.top -= intersection.height;
-								else
-									kinematicBody.rect.top += intersection.height;
-
-								kinematicCollision.staticallyMovedByY = true;
-							}
-						}
-					}
+						resolveStaticCollision(kinematicBody.rect, staticCollisionBodyRect, kinematicCollision);
 				}
 			}
 		}
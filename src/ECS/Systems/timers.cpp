@@ -0,0 +1,34 @@
+#include "timers.hpp"
+#include "ECS/timerWheel.hpp"
+#include "ECS/events.hpp"
+#include "Utilities/profiling.hpp"
+
+namespace ph::system {
+
+	Timers::Timers(entt::registry& registry)
+		:System(registry)
+	{
+		mRegistry.set<TimerWheel>();
+		mRegistry.on_construct<component::Lifetime>().connect<&Timers::scheduleDestroying>();
+	}
+
+	void Timers::declareAccess(SystemAccess& access) const
+	{
+		// callbacks of timers can do anything, these are events which they send
+		access.emits<event::Destroy, event::SpatialSound>()
+		      .runsExclusively();
+	}
+
+	void Timers::update(float dt)
+	{
+		PH_PROFILE_FUNCTION();
+
+		mRegistry.ctx<TimerWheel>().advance(dt, mRegistry);
+	}
+
+	void Timers::scheduleDestroying(entt::entity entity, entt::registry& registry, const component::Lifetime& lifetime)
+	{
+		registry.ctx<TimerWheel>().scheduleEvent<event::Destroy>(entity, lifetime.lifetime);
+	}
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "ECS/system.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+
+namespace ph::system {
+
+	// advances TimerWheel kept in registry context, entities with Lifetime are destroyed by its timers
+	class Timers : public System
+	{
+	public:
+		Timers(entt::registry& registry);
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		static void scheduleDestroying(entt::entity, entt::registry&, const component::Lifetime&);
+	};
+}
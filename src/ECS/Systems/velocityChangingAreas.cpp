@@ -1,23 +1,37 @@
 #include "velocityChangingAreas.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/spatialHash.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 
+	void VelocityChangingAreas::declareAccess(SystemAccess& access) const
+	{
+		access.reads<component::AreaVelocityChangingEffect, component::KinematicCollisionBody, component::BodyRect>()
+		      .writes<component::Velocity>()
+		      .usesReadOnly<SpatialHash>();
+	}
+
 	void VelocityChangingAreas::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
 		auto velocityChaningAreasView = mRegistry.view<component::BodyRect, component::AreaVelocityChangingEffect>();
 		auto kinematicObjectsView = mRegistry.view<component::KinematicCollisionBody, component::BodyRect, component::Velocity>();
+		const auto& spatialHash = mRegistry.ctx<SpatialHash>();
+		std::vector<entt::entity> objectsInArea;
 
 		for (auto velocityChangingArea : velocityChaningAreasView)
 		{
 			const auto& [areaBody, velocityChangeEffect] = velocityChaningAreasView.get<component::BodyRect, component::AreaVelocityChangingEffect>(velocityChangingArea);
 			
-			for (auto kinematicObject : kinematicObjectsView)
+			spatialHash.queryRect(areaBody.rect, objectsInArea);
+			for (auto kinematicObject : objectsInArea)
 			{
+				if (!kinematicObjectsView.contains(kinematicObject))
+					continue;
+
 				auto& objectVelocity = kinematicObjectsView.get<component::Velocity>(kinematicObject);
 				const auto& objectBody = kinematicObjectsView.get<component::BodyRect>(kinematicObject);
 
@@ -4,6 +4,11 @@
 
 namespace ph::system {
 
+	void VelocityClear::declareAccess(SystemAccess& access) const
+	{
+		access.writes<component::Velocity>();
+	}
+
 	void VelocityClear::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
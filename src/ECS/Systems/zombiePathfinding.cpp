@@ -0,0 +1,38 @@
+#include "zombiePathfinding.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/aiComponents.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/parallelForEach.hpp"
+#include "AI/aiManager.hpp"
+#include "Utilities/profiling.hpp"
+
+namespace ph::system {
+
+ZombiePathfinding::ZombiePathfinding(entt::registry& registry, const AIManager* aiManager)
+	:System(registry)
+	,mAIManager(aiManager)
+{
+}
+
+void ZombiePathfinding::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::BodyRect, component::DeadCharacter>()
+	      .writes<component::Zombie>()
+	      .uses<AIManager>();
+}
+
+void ZombiePathfinding::update(float dt)
+{
+	PH_PROFILE_FUNCTION();
+
+	parallelForEach<component::Zombie, component::BodyRect>(mRegistry, [this](component::Zombie& zombie, const component::BodyRect& body)
+	{
+		if(zombie.pathMode.path.empty())
+		{
+			zombie.pathMode = mAIManager->getZombiePath(body.rect.getTopLeft());
+			zombie.timeFromStartingThisMove = 0.f;
+		}
+	}, entt::exclude<component::DeadCharacter>);
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ECS/system.hpp"
+
+namespace ph {
+	class AIManager;	
+}
+
+namespace ph::system {
+
+	// finding paths is expensive, so it's separated from ZombieSystem and it can be updated less often
+	class ZombiePathfinding : public System 
+	{
+	public:
+		ZombiePathfinding(entt::registry&, const AIManager*);
+
+		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
+
+	private:
+		const AIManager* mAIManager;
+	};
+}
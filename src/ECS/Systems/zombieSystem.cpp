@@ -2,9 +2,11 @@
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/aiComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
-#include "ECS/Components/audioComponents.hpp"
 #include "ECS/Components/animationComponents.hpp"
-#include "AI/aiManager.hpp"
+#include "ECS/parallelForEach.hpp"
+#include "ECS/registryGroups.hpp"
+#include "ECS/events.hpp"
+#include "ECS/timerWheel.hpp"
 #include "Utilities/direction.hpp"
 #include "Utilities/random.hpp"
 #include "Utilities/profiling.hpp"
@@ -34,50 +36,29 @@ sf::Vector2f toDirectionVector(ph::Direction direction)
 
 namespace ph::system {
 
-ZombieSystem::ZombieSystem(entt::registry& registry, const AIManager* aiManager)
+ZombieSystem::ZombieSystem(entt::registry& registry)
 	:System(registry)
-	,mAIManager(aiManager)
 {
+	mRegistry.on_construct<component::Zombie>().connect<&ZombieSystem::startGrowling>();
+}
+
+void ZombieSystem::declareAccess(SystemAccess& access) const
+{
+	access.reads<component::CharacterSpeed, component::DeadCharacter>()
+	      .writes<component::Zombie, component::Velocity, component::AnimationData>();
 }
 
 void ZombieSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
-	const auto zombies = mRegistry.view<component::Zombie, component::BodyRect, component::CharacterSpeed, component::Velocity, component::AnimationData>
-		(entt::exclude<component::DeadCharacter>);
-	
-	for(auto zombieEntity : zombies)
+	parallelForEach(Groups::zombies(mRegistry), [dt]
+	(component::Zombie& zombie, const component::CharacterSpeed& speed,
+	 component::Velocity& velocity, component::AnimationData& animationData)
 	{
-		auto& [zombie, velocity, animationData] = zombies.get<component::Zombie, component::Velocity, component::AnimationData>(zombieEntity);
-		const auto& [body, speed] = zombies.get<component::BodyRect, component::CharacterSpeed>(zombieEntity);
-
-		// make sounds
-		zombie.timeFromLastGrowl += dt;
-		if(zombie.timeFromLastGrowl > 3.f)
-		{
-			zombie.timeFromLastGrowl = 0.f;
-			int randomNumber = Random::generateNumber(1, 4);
-			switch(randomNumber)
-			{
-				case 1: mRegistry.assign_or_replace<component::SpatialSound>(zombieEntity, "sounds/zombieGrowl1.ogg"); break;
-				case 2: mRegistry.assign_or_replace<component::SpatialSound>(zombieEntity, "sounds/zombieGrowl2.ogg"); break;
-				case 3: mRegistry.assign_or_replace<component::SpatialSound>(zombieEntity, "sounds/zombieGrowl3.ogg"); break;
-				case 4: mRegistry.assign_or_replace<component::SpatialSound>(zombieEntity, "sounds/zombieGrowl4.ogg"); break;
-				default:
-					PH_UNEXPECTED_SITUATION("Random sound choosing in ZombieSystem failed!");
-			}
-		}
-
-		// move body 
+		// move body, new path is found by ZombiePathfinding system
 		zombie.timeFromStartingThisMove += dt;
-		if(zombie.pathMode.path.empty())
-		{
-			zombie.pathMode = mAIManager->getZombiePath(body.rect.getTopLeft());
-			zombie.timeFromStartingThisMove = 0.f;
-		}
-
-		if(zombie.timeFromStartingThisMove > zombie.timeToMoveToAnotherTile)
+		if(zombie.timeFromStartingThisMove > zombie.timeToMoveToAnotherTile && !zombie.pathMode.path.empty())
 		{
 			zombie.timeFromStartingThisMove = 0.f;
 			Direction currentDirection = zombie.pathMode.path.front();
@@ -116,7 +97,34 @@ void ZombieSystem::update(float dt)
 		else {
 			animationData.isPlaying = false;
 		}
+	});
+}
+
+void ZombieSystem::startGrowling(entt::entity zombieEntity, entt::registry& registry, const component::Zombie&)
+{
+	// zombies created at the same time don't growl together
+	registry.ctx<TimerWheel>().schedule(zombieEntity, Random::generateNumber(0.5f, 3.f), &ZombieSystem::growl);
+}
+
+void ZombieSystem::growl(entt::registry& registry, entt::entity zombieEntity)
+{
+	// dead zombies stop growling
+	if(!registry.has<component::Zombie>(zombieEntity) || registry.has<component::DeadCharacter>(zombieEntity))
+		return;
+
+	const sf::Vector2f zombiePosition = registry.get<component::BodyRect>(zombieEntity).rect.getCenter();
+	auto& spatialSounds = registry.ctx<EventQueue<event::SpatialSound>>();
+	switch(Random::generateNumber(1, 4))
+	{
+		case 1: spatialSounds.emit("sounds/zombieGrowl1.ogg", zombiePosition); break;
+		case 2: spatialSounds.emit("sounds/zombieGrowl2.ogg", zombiePosition); break;
+		case 3: spatialSounds.emit("sounds/zombieGrowl3.ogg", zombiePosition); break;
+		case 4: spatialSounds.emit("sounds/zombieGrowl4.ogg", zombiePosition); break;
+		default:
+			PH_UNEXPECTED_SITUATION("Random sound choosing in ZombieSystem failed!");
 	}
+
+	registry.ctx<TimerWheel>().schedule(zombieEntity, 3.f, &ZombieSystem::growl);
 }
 
 }
@@ -1,21 +1,21 @@
 #pragma once
 
 #include "ECS/system.hpp"
-
-namespace ph {
-	class AIManager;	
-}
+#include "ECS/Components/aiComponents.hpp"
 
 namespace ph::system {
 
 	class ZombieSystem : public System 
 	{
 	public:
-		ZombieSystem(entt::registry&, const AIManager*);
+		ZombieSystem(entt::registry& registry);
 
 		void update(float dt) override;
+		void declareAccess(SystemAccess&) const override;
 
 	private:
-		const AIManager* mAIManager;
+		// growls are timers of TimerWheel, so zombies aren't checked every frame
+		static void startGrowling(entt::entity, entt::registry&, const component::Zombie&);
+		static void growl(entt::registry&, entt::entity);
 	};
 }
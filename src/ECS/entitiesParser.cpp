@@ -11,7 +11,6 @@
 #include "Renderer/API/shader.hpp"
 #include "Resources/animationStatesResources.hpp"
 #include "Utilities/xml.hpp"
-#include "Utilities/random.hpp"
 
 namespace ph {
 
@@ -34,6 +33,7 @@ void EntitiesParser::parseFile(const std::string& filePath, EntitiesTemplateStor
 	mUsedRegistry = &templateStorage.getTemplateRegistry();
 	const Xml entityTemplatesNode = entitiesFile.getChild("entityTemplates");
 	parseTemplates(entityTemplatesNode);
+	templateStorage.compileBlueprints();
 
 	// TODO: Enable entities parsing in some form
 	//mUsedRegistry = &gameRegistry;
@@ -44,6 +44,13 @@ void EntitiesParser::parseFile(const std::string& filePath, EntitiesTemplateStor
 	mUsedRegistry = nullptr;
 }
 
+template<typename T, typename... Args>
+void EntitiesParser::assignComponent(entt::entity entity, Args&&... arguments)
+{
+	mTemplateStorage->registerComponentType<T>();
+	mUsedRegistry->assign_or_replace<T>(entity, std::forward<Args>(arguments)...);
+}
+
 bool EntitiesParser::loadedPlayer() const
 {
 	return mHasLoadedPlayer;
@@ -150,7 +157,7 @@ void EntitiesParser::parseBodyRect(const Xml& entityComponentNode, entt::entity&
 	float y = entityComponentNode.getAttribute("y").toFloat();
 	float width = entityComponentNode.getAttribute("width").toFloat();
 	float height = entityComponentNode.getAttribute("height").toFloat();
-	mUsedRegistry->assign_or_replace<component::BodyRect>(entity, ph::FloatRect(x, y, width, height));
+	assignComponent<component::BodyRect>(entity, ph::FloatRect(x, y, width, height));
 }
 
 void EntitiesParser::parseRenderQuad(const Xml& entityComponentNode, entt::entity& entity)
@@ -211,7 +218,7 @@ void EntitiesParser::parseRenderQuad(const Xml& entityComponentNode, entt::entit
 	quad.z = entityComponentNode.hasAttribute("z") ? entityComponentNode.getAttribute("z").toUnsignedChar() : 100;
 
 	// assign component
-	mUsedRegistry->assign_or_replace<component::RenderQuad>(entity, quad);
+	assignComponent<component::RenderQuad>(entity, quad);
 }
 
 void EntitiesParser::parseTextureRect(const Xml& entityComponentNode, entt::entity& entity)
@@ -221,7 +228,7 @@ void EntitiesParser::parseTextureRect(const Xml& entityComponentNode, entt::enti
 	int width = entityComponentNode.getAttribute("width").toUnsigned();
 	int height = entityComponentNode.getAttribute("height").toUnsigned();
 	IntRect rect(left, top, width, height);
-	mUsedRegistry->assign_or_replace<component::TextureRect>(entity, rect);
+	assignComponent<component::TextureRect>(entity, rect);
 }
 
 void EntitiesParser::parseLightWall(const Xml& entityComponentNode, entt::entity& entity)
@@ -237,70 +244,70 @@ void EntitiesParser::parseLightWall(const Xml& entityComponentNode, entt::entity
 	else
 		rect = FloatRect(-1.f, -1.f, -1.f, -1.f);
 
-	mUsedRegistry->assign_or_replace<component::LightWall>(entity, rect);
+	assignComponent<component::LightWall>(entity, rect);
 }
 
 void EntitiesParser::parsePushingArea(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float directionX = entityComponentNode.getAttribute("pushForceX").toFloat();
 	float directionY = entityComponentNode.getAttribute("pushForceY").toFloat();
-	mUsedRegistry->assign_or_replace<component::PushingArea>(entity, sf::Vector2f(directionX, directionY));
+	assignComponent<component::PushingArea>(entity, sf::Vector2f(directionX, directionY));
 }
 
 void EntitiesParser::parseHint(const Xml& entityComponentNode, entt::entity& entity)
 {
 	std::string hintName = entityComponentNode.getAttribute("hintName").toString();
 	bool isShown = false;
-	mUsedRegistry->assign_or_replace<component::Hint>(entity, hintName, isShown);
+	assignComponent<component::Hint>(entity, hintName, isShown);
 }
 
 void EntitiesParser::parseCharacterSpeed(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float speed = entityComponentNode.getAttribute("speed").toFloat();
-	mUsedRegistry->assign_or_replace<component::CharacterSpeed>(entity, speed);
+	assignComponent<component::CharacterSpeed>(entity, speed);
 }
 
 void EntitiesParser::parseCollisionWithPlayer(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float pushForce = entityComponentNode.getAttribute("pushForce").toFloat();
-	mUsedRegistry->assign_or_replace<component::CollisionWithPlayer>(entity, pushForce, false);
+	assignComponent<component::CollisionWithPlayer>(entity, pushForce, false);
 }
 
 void EntitiesParser::parseVelocity(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float dx = entityComponentNode.getAttribute("dx").toFloat();
 	float dy = entityComponentNode.getAttribute("dy").toFloat();
-	mUsedRegistry->assign_or_replace<component::Velocity>(entity, dx, dy);
+	assignComponent<component::Velocity>(entity, dx, dy);
 }
 
 void EntitiesParser::parsePushingForces(const Xml& entityComponentNode, entt::entity& entity)
 {
 	sf::Vector2f vel = entityComponentNode.getAttribute("vel").toVector2f();
-	mUsedRegistry->assign_or_replace<component::PushingForces>(entity, vel);
+	assignComponent<component::PushingForces>(entity, vel);
 }
 
 void EntitiesParser::parseHealth(const Xml& entityComponentNode, entt::entity& entity)
 {
 	int healthPoints = entityComponentNode.getAttribute("healthPoints").toUnsigned();
 	int maxHealthPoints = entityComponentNode.getAttribute("maxHealthPoints").toUnsigned();
-	mUsedRegistry->assign_or_replace<component::Health>(entity, healthPoints, maxHealthPoints);
+	assignComponent<component::Health>(entity, healthPoints, maxHealthPoints);
 }
 
 void EntitiesParser::parseDamage(const Xml& entityComponentNode, entt::entity& entity)
 {
 	int damageDealt = entityComponentNode.getAttribute("damageDealt").toUnsigned();
-	mUsedRegistry->assign_or_replace<component::Damage>(entity, damageDealt);
+	assignComponent<component::Damage>(entity, damageDealt);
 }
 
 void EntitiesParser::parseMedkit(const Xml& entityComponentNode, entt::entity& entity)
 {
 	int addHealthPoints = entityComponentNode.getAttribute("addHealthPoints").toInt();
-	mUsedRegistry->assign_or_replace<component::Medkit>(entity, addHealthPoints);
+	assignComponent<component::Medkit>(entity, addHealthPoints);
 }
 
 void EntitiesParser::parsePlayer(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::Player>(entity);
+	assignComponent<component::Player>(entity);
 	mHasLoadedPlayer = true;
 }
 
@@ -309,13 +316,13 @@ void EntitiesParser::parseEntrance(const Xml& entityComponentNode, entt::entity&
 	std::string entranceDestination = entityComponentNode.getAttribute("entranceDestination").toString();
 	float posX = entityComponentNode.getAttribute("playerSpawnPositionX").toFloat();
 	float posY = entityComponentNode.getAttribute("playerSpawnPositionY").toFloat();
-	mUsedRegistry->assign_or_replace<component::Entrance>(entity, entranceDestination, sf::Vector2f(posX, posY));
+	assignComponent<component::Entrance>(entity, entranceDestination, sf::Vector2f(posX, posY));
 }
 
 void EntitiesParser::parseGate(const Xml& entityComponentNode, entt::entity& entity)
 {
 	bool isOpened = entityComponentNode.getAttribute("isOpened").toBool();
-	mUsedRegistry->assign_or_replace<component::Gate>(entity, isOpened);
+	assignComponent<component::Gate>(entity, isOpened);
 }
 
 void EntitiesParser::parseLever(const Xml& entityComponentNode, entt::entity& entity)
@@ -323,47 +330,47 @@ void EntitiesParser::parseLever(const Xml& entityComponentNode, entt::entity& en
 	unsigned leverId = entityComponentNode.getAttribute("id").toUnsigned();
 	bool isActivated = false;
 	bool turnOffAfterSwitch = entityComponentNode.getAttribute("turnOffAfterSwitch").toBool();
-	mUsedRegistry->assign_or_replace<component::Lever>(entity, leverId, isActivated, turnOffAfterSwitch);
+	assignComponent<component::Lever>(entity, leverId, isActivated, turnOffAfterSwitch);
 }
 
 void EntitiesParser::parseLeverListener(const Xml& entityComponentNode, entt::entity& entity)
 {
 	unsigned observedLeverId = entityComponentNode.getAttribute("observedLeverId").toUnsigned();
 	bool isActivated = false;
-	mUsedRegistry->assign_or_replace<component::LeverListener>(entity, observedLeverId, isActivated);
+	assignComponent<component::LeverListener>(entity, observedLeverId, isActivated);
 }
 
 void EntitiesParser::parseVelocityChangingEffect(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float velocityMultiplier = entityComponentNode.getAttribute("velocityMultiplier").toFloat();
-	mUsedRegistry->assign_or_replace<component::AreaVelocityChangingEffect>(entity, velocityMultiplier);
+	assignComponent<component::AreaVelocityChangingEffect>(entity, velocityMultiplier);
 }
 
 void EntitiesParser::parseKinematicCollisionBody(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float mass = entityComponentNode.getAttribute("mass").toFloat();
-	mUsedRegistry->assign_or_replace<component::KinematicCollisionBody>(entity, mass);
+	assignComponent<component::KinematicCollisionBody>(entity, mass);
 }
 
 void EntitiesParser::parseStaticCollisionBody(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::StaticCollisionBody>(entity);
+	assignComponent<component::StaticCollisionBody>(entity);
 }
 
 void EntitiesParser::parseMultiStaticCollisionBody(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::MultiStaticCollisionBody>(entity);
+	assignComponent<component::MultiStaticCollisionBody>(entity);
 }
 
 void EntitiesParser::parseFaceDirection(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::FaceDirection>(entity, sf::Vector2f(0, 0));
+	assignComponent<component::FaceDirection>(entity, sf::Vector2f(0, 0));
 }
 
 void EntitiesParser::parseLifetime(const Xml& entityComponentNode, entt::entity& entity)
 {
 	const float entityLifetime = entityComponentNode.getAttribute("lifetime").toFloat();
-	mUsedRegistry->assign_or_replace<component::Lifetime>(entity, entityLifetime);
+	assignComponent<component::Lifetime>(entity, entityLifetime);
 }
 
 void EntitiesParser::parseParticleEmitter(const Xml& entityComponentNode, entt::entity& entity)
@@ -446,50 +453,49 @@ void EntitiesParser::parseParticleEmitter(const Xml& entityComponentNode, entt::
 			emitter.isEmitting = attrib.getAttribute("v").toBool();
 		}
 	}
-	mUsedRegistry->assign_or_replace<component::ParticleEmitter>(entity, emitter);
+	assignComponent<component::ParticleEmitter>(entity, emitter);
 }
 
 void EntitiesParser::parseMultiParticleEmitter(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::MultiParticleEmitter>(entity);
+	assignComponent<component::MultiParticleEmitter>(entity);
 }
 
 void EntitiesParser::parseZombie(const Xml& entityComponentNode, entt::entity& entity)
 {
 	component::Zombie zombie;
-	zombie.timeFromLastGrowl = Random::generateNumber(0.f, 2.5f);
 	zombie.timeToMoveToAnotherTile = entityComponentNode.getAttribute("timeToMoveToAnotherTile").toFloat();
-	mUsedRegistry->assign_or_replace<component::Zombie>(entity, zombie);
+	assignComponent<component::Zombie>(entity, zombie);
 }
 
 void EntitiesParser::parseRenderChunk(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::RenderChunk>(entity);
+	assignComponent<component::RenderChunk>(entity);
 }
 
 void EntitiesParser::parseArcadeSpawner(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::ArcadeSpawner>(entity);
+	assignComponent<component::ArcadeSpawner>(entity);
 }
 
 void EntitiesParser::parseLootSpawner(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::LootSpawner>(entity);
+	assignComponent<component::LootSpawner>(entity);
 }
 
 void EntitiesParser::parseBulletBox(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::BulletBox>(entity);
+	assignComponent<component::BulletBox>(entity);
 }
 
 void EntitiesParser::parseCar(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::Car>(entity);
+	assignComponent<component::Car>(entity);
 }
 
 void EntitiesParser::parseCutScene(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign<component::CutScene>(entity);
+	assignComponent<component::CutScene>(entity);
 }
 
 void EntitiesParser::parseGunAttacker(const Xml& entityComponentNode, entt::entity& entity)
@@ -498,7 +504,7 @@ void EntitiesParser::parseGunAttacker(const Xml& entityComponentNode, entt::enti
 	gunAttacker.isTryingToAttack = entityComponentNode.getAttribute("isTryingToAttack").toBool();
 	gunAttacker.timeBeforeHiding = entityComponentNode.getAttribute("timeBeforeHiding").toFloat();
 	gunAttacker.timeToHide = 0.f;
-	mUsedRegistry->assign_or_replace<component::GunAttacker>(entity, gunAttacker);
+	assignComponent<component::GunAttacker>(entity, gunAttacker);
 }
 
 void EntitiesParser::parseMeleeProperties(const Xml& entityComponentNode, entt::entity& entity)
@@ -509,14 +515,14 @@ void EntitiesParser::parseMeleeProperties(const Xml& entityComponentNode, entt::
 	mp.rotationRange = entityComponentNode.getAttribute("rotationRange").toFloat();
 	mp.range = entityComponentNode.getAttribute("range").toFloat();
 	mp.damage = entityComponentNode.getAttribute("damage").toUnsigned();
-	mUsedRegistry->assign_or_replace<component::MeleeProperties>(entity, mp);
+	assignComponent<component::MeleeProperties>(entity, mp);
 }
 
 void EntitiesParser::parseGunProperties(const Xml& entityComponentNode, entt::entity& entity)
 {
 	component::GunProperties gp;
 
-	gp.shotSoundFilepath = entityComponentNode.getAttribute("shotSoundFilepath").toString();
+	gp.shotSoundFilepath = StringId::intern(entityComponentNode.getAttribute("shotSoundFilepath").toString());
 	gp.range = entityComponentNode.getAttribute("range").toFloat();
 	gp.deflectionAngle = entityComponentNode.getAttribute("deflectionAngle").toFloat();
 	gp.damage = entityComponentNode.getAttribute("damage").toUnsigned();
@@ -531,22 +537,22 @@ void EntitiesParser::parseGunProperties(const Xml& entityComponentNode, entt::en
 	else
 		PH_UNEXPECTED_SITUATION("Unknown Gun type!");
 	
-	mUsedRegistry->assign_or_replace<component::GunProperties>(entity, gp);
+	assignComponent<component::GunProperties>(entity, gp);
 }
 
 void EntitiesParser::parseCurrentGun(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::CurrentGun>(entity);
+	assignComponent<component::CurrentGun>(entity);
 }
 
 void EntitiesParser::parseCurrentMeleeWeapon(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::CurrentMeleeWeapon>(entity);
+	assignComponent<component::CurrentMeleeWeapon>(entity);
 }
 
 void EntitiesParser::parseKillable(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::Killable>(entity);
+	assignComponent<component::Killable>(entity);
 }
 
 void EntitiesParser::parseBullets(const Xml& entityComponentNode, entt::entity& entity)
@@ -554,12 +560,12 @@ void EntitiesParser::parseBullets(const Xml& entityComponentNode, entt::entity&
 	component::Bullets bullets;
 	bullets.numOfPistolBullets = entityComponentNode.getAttribute("numOfPistolBullets").toUnsigned();
 	bullets.numOfShotgunBullets = entityComponentNode.getAttribute("numOfShotgunBullets").toUnsigned();
-	mUsedRegistry->assign_or_replace<component::Bullets>(entity, bullets);
+	assignComponent<component::Bullets>(entity, bullets);
 }
 
 void EntitiesParser::parseHiddenForRenderer(const Xml& entityComponentNode, entt::entity& entity)
 {
-	mUsedRegistry->assign_or_replace<component::HiddenForRenderer>(entity);
+	assignComponent<component::HiddenForRenderer>(entity);
 }
 
 void EntitiesParser::parseCamera(const Xml& entityComponentNode, entt::entity& entity)
@@ -568,8 +574,8 @@ void EntitiesParser::parseCamera(const Xml& entityComponentNode, entt::entity& e
 	sf::Vector2f size(entityComponentNode.getAttribute("width").toFloat(), entityComponentNode.getAttribute("height").toFloat());
 	sf::Vector2f center(entityComponentNode.getAttribute("x").toFloat() + (size.x / 2.f), entityComponentNode.getAttribute("y").toFloat() + (size.y / 2.f));
 	camera.camera = Camera(center, size);
-	camera.name = entityComponentNode.getAttribute("cameraName").toString();
-	mUsedRegistry->assign_or_replace<component::Camera>(entity, camera);
+	camera.name = StringId::intern(entityComponentNode.getAttribute("cameraName").toString());
+	assignComponent<component::Camera>(entity, camera);
 	component::Camera::currentCameraName = "default";
 }
 
@@ -586,7 +592,7 @@ void EntitiesParser::parseLightSource(const Xml& entityComponentNode, entt::enti
 	lightSource.attenuationAddition = entityComponentNode.getAttribute("attenuationAddition").toFloat();
 	lightSource.attenuationFactor = entityComponentNode.getAttribute("attenuationFactor").toFloat();
 	lightSource.attenuationSquareFactor = entityComponentNode.getAttribute("attenuationSquareFactor").toFloat();
-	mUsedRegistry->assign_or_replace<component::LightSource>(entity, lightSource);
+	assignComponent<component::LightSource>(entity, lightSource);
 }
 
 void EntitiesParser::parseAnimationData(const Xml& entityComponentNode, entt::entity& entity)
@@ -597,7 +603,7 @@ void EntitiesParser::parseAnimationData(const Xml& entityComponentNode, entt::en
 	loadAnimationStatesFromFile(animationStateFilepath);
 	animationData.states = getAnimationStates(animationStateFilepath);
 	
-	animationData.currentStateName = entityComponentNode.getAttribute("firstStateName").toString();
+	animationData.currentStateName = StringId::intern(entityComponentNode.getAttribute("firstStateName").toString());
 
 	const float delay = entityComponentNode.getAttribute("delay").toFloat();
 	animationData.delay = delay;
@@ -608,7 +614,7 @@ void EntitiesParser::parseAnimationData(const Xml& entityComponentNode, entt::en
 	else
 		animationData.isPlaying = false;
 	
-	mUsedRegistry->assign_or_replace<component::AnimationData>(entity, animationData);
+	assignComponent<component::AnimationData>(entity, animationData);
 }
 
 }
@@ -21,6 +21,10 @@ private:
 	void parseEntities(const Xml& entitiesNode);
 	void parseComponents(std::vector<Xml>& entityComponents, entt::entity& entity);
 
+	// registers type of the component in template storage, so it can be compiled into blueprints
+	template<typename T, typename... Args>
+	void assignComponent(entt::entity entity, Args&&... arguments);
+
 	void parseBodyRect(const Xml& entityComponentNode, entt::entity& entity);
 	void parseRenderQuad(const Xml& entityComponentNode, entt::entity& entity);
 	void parseTextureRect(const Xml& entityComponentNode, entt::entity& entity);
@@ -0,0 +1,67 @@
+#include "entitiesPool.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+
+namespace ph {
+
+EntitiesPool::EntitiesPool(EntitiesTemplateStorage& templateStorage)
+	:mTemplateStorage(templateStorage)
+{
+	addComponentTypes<component::Pooled>();
+}
+
+std::vector<entt::entity> EntitiesPool::createCopies(const std::string& templateName, entt::registry& registry, size_t count)
+{
+	const auto prototype = mTemplateStorage.getTemplate(templateName);
+	auto& inactiveEntities = mInactiveEntities[prototype];
+
+	// reuse entities which wait in the pool
+	const size_t nrOfReused = std::min(count, inactiveEntities.size());
+	std::vector<entt::entity> copies(inactiveEntities.end() - nrOfReused, inactiveEntities.end());
+	inactiveEntities.resize(inactiveEntities.size() - nrOfReused);
+	mTemplateStorage.stomp(copies, templateName, registry);
+
+	// create the rest
+	const size_t nrOfNew = count - nrOfReused;
+	if(nrOfNew > 0)
+	{
+		for(const auto& componentType : mComponentTypes)
+			componentType.reserve(registry, nrOfNew);
+		const auto newCopies = mTemplateStorage.createCopies(templateName, registry, nrOfNew);
+		copies.insert(copies.end(), newCopies.begin(), newCopies.end());
+	}
+
+	for(auto copy : copies)
+		registry.assign<component::Pooled>(copy, prototype);
+	return copies;
+}
+
+entt::entity EntitiesPool::createCopy(const std::string& templateName, entt::registry& registry)
+{
+	return createCopies(templateName, registry, 1).front();
+}
+
+void EntitiesPool::deactivate(entt::entity entity, entt::registry& registry)
+{
+	const auto prototype = registry.get<component::Pooled>(entity).prototype;
+	for(const auto& componentType : mComponentTypes)
+		componentType.remove(registry, entity);
+
+	PH_ASSERT_UNEXPECTED_SITUATION(registry.orphan(entity), "Pooled entity has component which wasn't given to EntitiesPool::addComponentTypes()!");
+
+	// identifier gets new version, so handles of the old entity which are still kept by systems, events and timers become invalid.
+	// Registry recycles the identifier which was released last, so the entity keeps its index in sparse sets of component pools
+	registry.destroy(entity);
+	const auto inactiveEntity = registry.create();
+	PH_ASSERT_UNEXPECTED_SITUATION(registry.entity(inactiveEntity) == registry.entity(entity), "Deactivated entity didn't keep its index!");
+	mInactiveEntities[prototype].emplace_back(inactiveEntity);
+}
+
+size_t EntitiesPool::getNrOfInactiveEntities(const std::string& templateName) const
+{
+	auto found = mInactiveEntities.find(mTemplateStorage.getTemplate(templateName));
+	return found != mInactiveEntities.end() ? found->second.size() : 0;
+}
+
+}
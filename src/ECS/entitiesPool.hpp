@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ECS/entitiesTemplateStorage.hpp"
+#include <entt/entity/registry.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ph {
+
+// Entities copied from templates which are no longer needed are deactivated here instead of being destroyed.
+// Deactivated entity loses all its components and waits in the pool, then createCopies() resets waiting entities
+// from the template in bulk before it creates new ones. Deactivated entity keeps its index but gets new version,
+// so its old handles aren't valid anymore and can't reach the entity which reuses it.
+//
+// Scene can keep one instance as registry context variable. EntityDestroying deactivates entities
+// which have component::Pooled instead of destroying them, if the pool is there.
+
+class EntitiesPool
+{
+public:
+	explicit EntitiesPool(EntitiesTemplateStorage&);
+
+	// every component which pooled entities can have must be given here, including the ones assigned by systems,
+	// these are removed on deactivation and their pools are reserved before new entities are created
+	template<typename... Component>
+	void addComponentTypes();
+
+	std::vector<entt::entity> createCopies(const std::string& templateName, entt::registry&, size_t count);
+	entt::entity createCopy(const std::string& templateName, entt::registry&);
+
+	// given handle isn't valid after that
+	void deactivate(entt::entity, entt::registry&);
+
+	size_t getNrOfInactiveEntities(const std::string& templateName) const;
+
+private:
+	struct ComponentType
+	{
+		void(*remove)(entt::registry&, entt::entity);
+		void(*reserve)(entt::registry&, size_t nrOfNewEntities);
+	};
+
+private:
+	std::unordered_map<entt::entity, std::vector<entt::entity>> mInactiveEntities;
+	std::vector<ComponentType> mComponentTypes;
+	EntitiesTemplateStorage& mTemplateStorage;
+};
+
+}
+
+#include "entitiesPool.inl"
@@ -0,0 +1,14 @@
+namespace ph {
+
+template<typename... Component>
+void EntitiesPool::addComponentTypes()
+{
+	(mComponentTypes.push_back({
+		[](entt::registry& registry, entt::entity entity) {
+			registry.reset<Component>(entity);
+		},
+		&EntitiesTemplateStorage::reservePoolForCopies<Component>
+	}), ...);
+}
+
+}
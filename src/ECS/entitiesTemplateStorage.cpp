@@ -20,7 +20,15 @@ entt::entity EntitiesTemplateStorage::create(const std::string& templateName)
 
 entt::entity EntitiesTemplateStorage::createCopy(const std::string& templateName, entt::registry& gameRegistry)
 {
-	return gameRegistry.create(getTemplate(templateName), mTemplatesRegistry);
+	const auto entityTemplate = getTemplate(templateName);
+	if(const auto* blueprint = getBlueprint(entityTemplate))
+	{
+		auto copy = gameRegistry.create();
+		for(const auto& component : *blueprint)
+			component.assign(component.value.get(), copy, gameRegistry);
+		return copy;
+	}
+	return gameRegistry.create(entityTemplate, mTemplatesRegistry);
 }
 
 entt::entity EntitiesTemplateStorage::getTemplate(const std::string& templateName)
@@ -35,7 +43,37 @@ void EntitiesTemplateStorage::stomp(const entt::entity dst, const std::string& t
 
 void EntitiesTemplateStorage::stomp(const entt::entity dst, const std::string& templateName, entt::registry& gameRegistry)
 {
-	gameRegistry.stomp(dst, getTemplate(templateName), mTemplatesRegistry);
+	stomp(std::vector<entt::entity>{dst}, templateName, gameRegistry);
+}
+
+void EntitiesTemplateStorage::stomp(const std::vector<entt::entity>& dstEntities, const std::string& templateName, entt::registry& gameRegistry)
+{
+	const auto entityTemplate = getTemplate(templateName);
+	if(const auto* blueprint = getBlueprint(entityTemplate))
+	{
+		for(const auto& component : *blueprint)
+			for(auto dst : dstEntities)
+				component.assignOrReplace(component.value.get(), dst, gameRegistry);
+	}
+	else
+		gameRegistry.stomp(dstEntities.begin(), dstEntities.end(), entityTemplate, mTemplatesRegistry);
+}
+
+void EntitiesTemplateStorage::compileBlueprints()
+{
+	mBlueprints.clear();
+	for(const auto& [templateName, entityTemplate] : mTemplatesMap)
+	{
+		auto& blueprint = mBlueprints[entityTemplate];
+		for(auto compileComponent : mBlueprintCompilers)
+			compileComponent(mTemplatesRegistry, entityTemplate, blueprint);
+	}
+}
+
+const EntitiesTemplateStorage::Blueprint* EntitiesTemplateStorage::getBlueprint(entt::entity entityTemplate) const
+{
+	auto found = mBlueprints.find(entityTemplate);
+	return found != mBlueprints.end() ? &found->second : nullptr;
 }
 
 }
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "entt/entity/registry.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace ph {
 
@@ -14,8 +17,25 @@ public:
 
 	entt::entity create(const std::string& templateName);
 	entt::entity createCopy(const std::string& templateName, entt::registry& gameRegistry);
+
+	// creates many copies at once, pools of given components are reserved for all of them before copying
+	template<typename... Component>
+	std::vector<entt::entity> createCopies(const std::string& templateName, entt::registry& gameRegistry, size_t count);
+	template<typename Component>
+	static void reservePoolForCopies(entt::registry& gameRegistry, size_t count);
+
 	void stomp(const entt::entity dstEntity, const std::string& templateName);
 	void stomp(const entt::entity dstEntity, const std::string& templateName, entt::registry& gameRegistry);
+	void stomp(const std::vector<entt::entity>& dstEntities, const std::string& templateName, entt::registry& gameRegistry);
+
+	// every type of component which templates can have must be registered before compileBlueprints(),
+	// assign() and assign_or_replace() do it on their own
+	template<typename T>
+	void registerComponentType();
+
+	// turns every template into list of its components with functions which copy them,
+	// so copies of the template don't have to look through all pools of the template registry
+	void compileBlueprints();
 
 	template<typename T, typename... Args>
 	void assign(const std::string& templateName, Args&&... arguments);
@@ -37,8 +57,25 @@ public:
 	template<typename T>
 	T get(entt::entity& templateEntity);
 
+private:
+	struct BlueprintComponent
+	{
+		std::shared_ptr<const void> value;
+		void(*assign)(const void* value, entt::entity, entt::registry&);
+		void(*assignOrReplace)(const void* value, entt::entity, entt::registry&);
+	};
+	using Blueprint = std::vector<BlueprintComponent>;
+	using BlueprintCompiler = void(*)(const entt::registry& templatesRegistry, entt::entity entityTemplate, Blueprint&);
+
+	template<typename T>
+	static void compileBlueprintComponent(const entt::registry& templatesRegistry, entt::entity entityTemplate, Blueprint&);
+
+	const Blueprint* getBlueprint(entt::entity entityTemplate) const;
+
 private:
 	std::unordered_map<std::string, entt::entity> mTemplatesMap;
+	std::unordered_map<entt::entity, Blueprint> mBlueprints;
+	std::vector<BlueprintCompiler> mBlueprintCompilers;
 	entt::registry mTemplatesRegistry;
 };
 
@@ -1,15 +1,40 @@
 namespace ph {
 
+template<typename... Component>
+std::vector<entt::entity> EntitiesTemplateStorage::createCopies(const std::string& templateName, entt::registry& gameRegistry, size_t count)
+{
+	// reserving exactly as much as needed would reallocate on every call, so capacity is at least doubled
+	if(gameRegistry.size() + count > gameRegistry.capacity())
+		gameRegistry.reserve(std::max(gameRegistry.size() + count, 2 * gameRegistry.capacity()));
+	(reservePoolForCopies<Component>(gameRegistry, count), ...);
+
+	// components are copied pool after pool instead of entity after entity
+	const auto entityTemplate = getTemplate(templateName);
+	std::vector<entt::entity> copies(count);
+	if(const auto* blueprint = getBlueprint(entityTemplate))
+	{
+		gameRegistry.create(copies.begin(), copies.end());
+		for(const auto& component : *blueprint)
+			for(auto copy : copies)
+				component.assign(component.value.get(), copy, gameRegistry);
+	}
+	else
+		gameRegistry.create(copies.begin(), copies.end(), entityTemplate, mTemplatesRegistry);
+	return copies;
+}
+
 template<typename T, typename... Args>
 void EntitiesTemplateStorage::assign(const std::string& templateName, Args&&... arguments)
 {
 	auto entityTemplate = mTemplatesMap.at(templateName);
-	mTemplatesRegistry.assign<T>(entityTemplate, arguments...);
+	assign<T>(entityTemplate, arguments...);
 }
 
 template<typename T, typename... Args>
 void EntitiesTemplateStorage::assign(entt::entity& templateEntity, Args&&... arguments)
 {
+	registerComponentType<T>();
+	mBlueprints.erase(templateEntity);
 	mTemplatesRegistry.assign<T>(templateEntity, arguments...);
 }
 
@@ -17,12 +42,14 @@ template<typename T, typename... Args>
 void EntitiesTemplateStorage::assign_or_replace(const std::string& templateName, Args&&... arguments)
 {
 	auto entityTemplate = mTemplatesMap.at(templateName);
-	mTemplatesRegistry.assign_or_replace<T>(entityTemplate, arguments...);
+	assign_or_replace<T>(entityTemplate, arguments...);
 }
 
 template<typename T, typename... Args>
 void EntitiesTemplateStorage::assign_or_replace(entt::entity& templateEntity, Args&&... arguments)
 {
+	registerComponentType<T>();
+	mBlueprints.erase(templateEntity);
 	mTemplatesRegistry.assign_or_replace<T>(templateEntity, arguments...);
 }
 
@@ -52,4 +79,48 @@ T EntitiesTemplateStorage::get(entt::entity& templateEntity)
 	return mTemplatesRegistry.get<T>(templateEntity);
 }
 
+template<typename Component>
+void EntitiesTemplateStorage::reservePoolForCopies(entt::registry& gameRegistry, size_t count)
+{
+	const size_t size = gameRegistry.size<Component>();
+	const size_t capacity = gameRegistry.capacity<Component>();
+	if(size + count > capacity)
+		gameRegistry.reserve<Component>(std::max(size + count, 2 * capacity));
+}
+
+template<typename T>
+void EntitiesTemplateStorage::registerComponentType()
+{
+	const BlueprintCompiler compiler = &compileBlueprintComponent<T>;
+	if(std::find(mBlueprintCompilers.begin(), mBlueprintCompilers.end(), compiler) == mBlueprintCompilers.end())
+		mBlueprintCompilers.emplace_back(compiler);
+}
+
+template<typename T>
+void EntitiesTemplateStorage::compileBlueprintComponent(const entt::registry& templatesRegistry, entt::entity entityTemplate, Blueprint& blueprint)
+{
+	if(!templatesRegistry.has<T>(entityTemplate))
+		return;
+
+	// new copies don't have to check if they already have the component
+	if constexpr(std::is_empty_v<T>)
+	{
+		blueprint.push_back({nullptr,
+			[](const void*, entt::entity copy, entt::registry& gameRegistry) { gameRegistry.assign<T>(copy); },
+			[](const void*, entt::entity copy, entt::registry& gameRegistry) { gameRegistry.assign_or_replace<T>(copy); }
+		});
+	}
+	else
+	{
+		blueprint.push_back({std::make_shared<const T>(templatesRegistry.get<T>(entityTemplate)),
+			[](const void* value, entt::entity copy, entt::registry& gameRegistry) {
+				gameRegistry.assign<T>(copy, *static_cast<const T*>(value));
+			},
+			[](const void* value, entt::entity copy, entt::registry& gameRegistry) {
+				gameRegistry.assign_or_replace<T>(copy, *static_cast<const T*>(value));
+			}
+		});
+	}
+}
+
 }
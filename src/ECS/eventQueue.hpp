@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace ph {
+
+// Events are messages which systems send to systems updated later, for example damage which was dealt or sound which should be played.
+// Unlike one-frame tag components they don't add or remove components, so they don't reshuffle registry pools.
+//
+// Queue of every event type is registry context variable. Systems declare which events they send and handle with
+// SystemAccess::emits() and receives(), then SystemsQueue clears queues after their receivers were updated:
+// after every fixed step if all systems which use the events are fixed step systems, otherwise at the end of the frame.
+
+template<typename Event>
+class EventQueue
+{
+public:
+	template<typename... Args>
+	void emit(Args&&... arguments) { mEvents.push_back(Event{std::forward<Args>(arguments)...}); }
+
+	void clear() { mEvents.clear(); }
+
+	auto begin() const { return mEvents.cbegin(); }
+	auto end() const { return mEvents.cend(); }
+	size_t size() const { return mEvents.size(); }
+	bool empty() const { return mEvents.empty(); }
+
+private:
+	std::vector<Event> mEvents;
+};
+
+}
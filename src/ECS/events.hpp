@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Utilities/stringId.hpp"
+#include <entt/entity/fwd.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace ph::event {
+
+	// damage of many events sent to one entity in the same step is summed up
+	struct Damage
+	{
+		entt::entity entity;
+		int amountOfDamage;
+	};
+
+	// entity is destroyed by EntityDestroying, or deactivated if it's pooled
+	struct Destroy
+	{
+		entt::entity entity;
+	};
+
+	struct AmbientSound
+	{
+		StringId filepath;
+	};
+
+	struct SpatialSound
+	{
+		StringId filepath;
+		sf::Vector2f position;
+	};
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Utilities/jobSystem.hpp"
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+#include <entt/entity/group.hpp>
+
+namespace ph {
+
+// Works like registry.view<Component...>(exclude).each(function) but entities are split into chunks which are updated by many threads.
+// Function is called at the same time for different entities, so it can only modify components of the entity
+// which it was given. It can't assign or remove components and create or destroy entities.
+//
+// Example:
+//   parallelForEach<component::BodyRect, component::Velocity>(mRegistry, [dt](component::BodyRect& body, const component::Velocity& vel) {
+//       ...
+//   }, entt::exclude<component::PushingForces>);
+
+template<typename... Component, typename... Exclude, typename Function>
+void parallelForEach(entt::registry& registry, const Function& function, entt::exclude_t<Exclude...> = {},
+                     JobSystem& jobSystem = JobSystem::getInstance(), size_t minEntitiesPerJob = 1024);
+
+// Works like group.each(function) with the same rules as above. Owned components are taken from packed arrays of the group,
+// only components which group doesn't own are looked up for every entity.
+//
+// Example:
+//   parallelForEach(Groups::movingBodies(mRegistry), [dt](component::BodyRect& body, const component::Velocity& vel) {
+//       ...
+//   });
+
+template<typename... Exclude, typename... Get, typename... Owned, typename Function>
+void parallelForEach(const entt::basic_group<entt::entity, entt::exclude_t<Exclude...>, entt::get_t<Get...>, Owned...>& group, const Function& function,
+                     JobSystem& jobSystem = JobSystem::getInstance(), size_t minEntitiesPerJob = 1024);
+
+}
+
+#include "parallelForEach.inl"
@@ -0,0 +1,60 @@
+#include <type_traits>
+#include <limits>
+#include <tuple>
+
+namespace ph {
+
+template<typename... Component, typename... Exclude, typename Function>
+void parallelForEach(entt::registry& registry, const Function& function, entt::exclude_t<Exclude...>,
+                     JobSystem& jobSystem, size_t minEntitiesPerJob)
+{
+	// like view.each() we iterate over the smallest pool and skip entities which don't have other components,
+	// single component views are used because they test and get components without looking up pools of registry
+	const auto views = std::make_tuple(registry.view<Component>()...);
+	const auto excludedViews = std::make_tuple(registry.view<Exclude>()...);
+
+	const entt::entity* entities = nullptr;
+	size_t nrOfEntities = std::numeric_limits<size_t>::max();
+	((std::get<entt::view<entt::exclude_t<>, Component>>(views).size() < nrOfEntities ?
+		(entities = std::get<entt::view<entt::exclude_t<>, Component>>(views).data(), nrOfEntities = std::get<entt::view<entt::exclude_t<>, Component>>(views).size()) : 0), ...);
+
+	jobSystem.parallelFor(nrOfEntities, minEntitiesPerJob, [&views, &excludedViews, &function, entities](size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+		{
+			const auto entity = entities[i];
+			if constexpr(sizeof...(Component) > 1 || sizeof...(Exclude) > 0) {
+				if(!(std::get<entt::view<entt::exclude_t<>, Component>>(views).contains(entity) && ...) ||
+				   (std::get<entt::view<entt::exclude_t<>, Exclude>>(excludedViews).contains(entity) || ...))
+					continue;
+			}
+
+			if constexpr(std::is_invocable_v<Function, decltype(std::get<entt::view<entt::exclude_t<>, Component>>(views).get(entity))...>)
+				function(std::get<entt::view<entt::exclude_t<>, Component>>(views).get(entity)...);
+			else
+				function(entity, std::get<entt::view<entt::exclude_t<>, Component>>(views).get(entity)...);
+		}
+	});
+}
+
+template<typename... Exclude, typename... Get, typename... Owned, typename Function>
+void parallelForEach(const entt::basic_group<entt::entity, entt::exclude_t<Exclude...>, entt::get_t<Get...>, Owned...>& group, const Function& function,
+                     JobSystem& jobSystem, size_t minEntitiesPerJob)
+{
+	// entities of group and their owned components are at the same indices at the beginning of pools
+	const entt::entity* entities = group.data();
+	const auto ownedComponents = std::make_tuple(group.template raw<Owned>()...);
+
+	jobSystem.parallelFor(group.size(), minEntitiesPerJob, [&group, &function, entities, ownedComponents](size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+		{
+			if constexpr(std::is_invocable_v<Function, Owned&..., decltype(group.template get<Get>(entities[i]))...>)
+				function(std::get<Owned*>(ownedComponents)[i]..., group.template get<Get>(entities[i])...);
+			else
+				function(entities[i], std::get<Owned*>(ownedComponents)[i]..., group.template get<Get>(entities[i])...);
+		}
+	});
+}
+
+}
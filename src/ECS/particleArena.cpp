@@ -0,0 +1,192 @@
+#include "particleArena.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+
+namespace ph {
+
+auto ParticleArena::allocateRange(unsigned capacity) -> RangeId
+{
+	unsigned first = 0;
+	if(capacity > 0)
+	{
+		// the smallest free block which is big enough
+		auto block = mFreeBlocks.end();
+		for(auto it = mFreeBlocks.begin(); it != mFreeBlocks.end(); ++it)
+			if(it->capacity >= capacity && (block == mFreeBlocks.end() || it->capacity < block->capacity))
+				block = it;
+
+		const unsigned arenaSize = static_cast<unsigned>(mLifetimes.size());
+		if(block != mFreeBlocks.end()) {
+			first = block->first;
+			block->first += capacity;
+			block->capacity -= capacity;
+			if(block->capacity == 0)
+				mFreeBlocks.erase(block);
+		}
+		else {
+			// free block at the end of the arena is extended instead of being left behind
+			first = arenaSize;
+			if(!mFreeBlocks.empty() && mFreeBlocks.back().first + mFreeBlocks.back().capacity == arenaSize) {
+				first = mFreeBlocks.back().first;
+				mFreeBlocks.pop_back();
+			}
+
+			const size_t newArenaSize = first + capacity;
+			mPositionsX.resize(newArenaSize);
+			mPositionsY.resize(newArenaSize);
+			mVelocitiesX.resize(newArenaSize);
+			mVelocitiesY.resize(newArenaSize);
+			mLifetimes.resize(newArenaSize);
+			mColors.resize(newArenaSize);
+		}
+	}
+
+	const Range range{first, capacity, 0, 0};
+	if(!mFreeRangeIds.empty()) {
+		const RangeId rangeId = mFreeRangeIds.back();
+		mFreeRangeIds.pop_back();
+		mRanges[rangeId] = range;
+		return rangeId;
+	}
+	mRanges.emplace_back(range);
+	return static_cast<RangeId>(mRanges.size() - 1);
+}
+
+void ParticleArena::freeRange(RangeId rangeId)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(rangeId < mRanges.size(), "Particle range doesn't exist!");
+
+	Range& range = mRanges[rangeId];
+	if(range.capacity > 0)
+	{
+		auto next = std::lower_bound(mFreeBlocks.begin(), mFreeBlocks.end(), range.first,
+			[](const FreeBlock& block, unsigned first) { return block.first < first; });
+		auto block = mFreeBlocks.insert(next, FreeBlock{range.first, range.capacity});
+
+		// merge with adjacent blocks
+		if(block + 1 != mFreeBlocks.end() && block->first + block->capacity == (block + 1)->first) {
+			block->capacity += (block + 1)->capacity;
+			mFreeBlocks.erase(block + 1);
+		}
+		if(block != mFreeBlocks.begin() && (block - 1)->first + (block - 1)->capacity == block->first) {
+			(block - 1)->capacity += block->capacity;
+			mFreeBlocks.erase(block);
+		}
+	}
+
+	range = Range{0, 0, 0, 0};
+	mFreeRangeIds.emplace_back(rangeId);
+}
+
+void ParticleArena::spawn(RangeId rangeId, sf::Vector2f position, sf::Vector2f velocity)
+{
+	Range& range = mRanges[rangeId];
+	PH_ASSERT_UNEXPECTED_SITUATION(range.count < range.capacity, "Particle range is full!");
+
+	const unsigned index = range.first + (range.oldest + range.count) % range.capacity;
+	mPositionsX[index] = position.x;
+	mPositionsY[index] = position.y;
+	mVelocitiesX[index] = velocity.x;
+	mVelocitiesY[index] = velocity.y;
+	mLifetimes[index] = 0.f;
+	++range.count;
+}
+
+void ParticleArena::killOldParticles(RangeId rangeId, float wholeLifetime)
+{
+	Range& range = mRanges[rangeId];
+	while(range.count > 0 && mLifetimes[range.first + range.oldest] >= wholeLifetime) {
+		range.oldest = range.oldest + 1 == range.capacity ? 0 : range.oldest + 1;
+		--range.count;
+	}
+}
+
+void ParticleArena::update(RangeId rangeId, float dt, sf::Vector2f acceleration, Vector4f startColor, Vector4f endColor, float wholeLifetime)
+{
+	float* positionsX = mPositionsX.data();
+	float* positionsY = mPositionsY.data();
+	float* velocitiesX = mVelocitiesX.data();
+	float* velocitiesY = mVelocitiesY.data();
+	float* lifetimes = mLifetimes.data();
+	Vector4f* colors = mColors.data();
+
+	const sf::Vector2f velocityChange = acceleration * dt;
+	const Vector4f colorChange{endColor.x - startColor.x, endColor.y - startColor.y, endColor.z - startColor.z, endColor.w - startColor.w};
+	const float inverseWholeLifetime = 1.f / wholeLifetime;
+
+	// every loop touches only a couple of arrays and has no branches, so compiler can vectorize it
+	forEachPart(mRanges[rangeId], [=](unsigned begin, unsigned end)
+	{
+		for(unsigned i = begin; i < end; ++i)
+			lifetimes[i] += dt;
+
+		for(unsigned i = begin; i < end; ++i) {
+			velocitiesX[i] += velocityChange.x;
+			positionsX[i] += velocitiesX[i] * dt;
+		}
+
+		for(unsigned i = begin; i < end; ++i) {
+			velocitiesY[i] += velocityChange.y;
+			positionsY[i] += velocitiesY[i] * dt;
+		}
+
+		for(unsigned i = begin; i < end; ++i) {
+			const float t = std::min(lifetimes[i] * inverseWholeLifetime, 1.f);
+			colors[i].x = startColor.x + colorChange.x * t;
+			colors[i].y = startColor.y + colorChange.y * t;
+			colors[i].z = startColor.z + colorChange.z * t;
+			colors[i].w = startColor.w + colorChange.w * t;
+		}
+	});
+}
+
+void ParticleArena::appendQuads(RangeId rangeId, sf::Vector2f positionOffset, sf::Vector2f size, std::vector<QuadData>& quads) const
+{
+	QuadData quad;
+	quad.textureRect = FloatRect(0.f, 0.f, 1.f, 1.f);
+	quad.size = size;
+	quad.rotationOrigin = {0.f, 0.f};
+	quad.rotation = 0.f;
+	quad.textureSlotRef = 0.f;
+
+	size_t quadIndex = quads.size();
+	quads.resize(quadIndex + mRanges[rangeId].count, quad);
+	forEachPart(mRanges[rangeId], [&](unsigned begin, unsigned end)
+	{
+		for(unsigned i = begin; i < end; ++i, ++quadIndex) {
+			quads[quadIndex].color = mColors[i];
+			quads[quadIndex].position = {mPositionsX[i] + positionOffset.x, mPositionsY[i] + positionOffset.y};
+		}
+	});
+}
+
+unsigned ParticleArena::getNrOfParticles(RangeId rangeId) const
+{
+	return mRanges[rangeId].count;
+}
+
+float ParticleArena::getLifetimeOfNewestParticle(RangeId rangeId) const
+{
+	const Range& range = mRanges[rangeId];
+	PH_ASSERT_UNEXPECTED_SITUATION(range.count > 0, "Particle range is empty!");
+	return mLifetimes[getIndexOfNewest(range)];
+}
+
+template<typename Function>
+void ParticleArena::forEachPart(const Range& range, Function function) const
+{
+	if(range.count == 0)
+		return;
+
+	const unsigned end = range.oldest + range.count;
+	function(range.first + range.oldest, range.first + std::min(end, range.capacity));
+	if(end > range.capacity)
+		function(range.first, range.first + end - range.capacity);
+}
+
+unsigned ParticleArena::getIndexOfNewest(const Range& range) const
+{
+	return range.first + (range.oldest + range.count - 1) % range.capacity;
+}
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Renderer/MinorRenderers/quadData.hpp"
+#include "Utilities/vector4.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+namespace ph {
+
+// All particles of the scene kept as structure of arrays, so updating them is a few simple loops over floats.
+// Every emitter gets a range of the arena as big as its maximal number of particles. Particles of an emitter
+// have the same whole lifetime, so they die in the order they were spawned, and the range is used as ring -
+// the oldest particle dies at the front and new one is spawned at the back without moving other particles.
+//
+// PatricleSystem keeps one instance, emitters keep identifiers of their ranges.
+
+class ParticleArena
+{
+public:
+	using RangeId = unsigned;
+	static constexpr RangeId sNullRange = ~0u;
+
+	RangeId allocateRange(unsigned capacity);
+	void freeRange(RangeId);
+
+	// range must not be full
+	void spawn(RangeId, sf::Vector2f position, sf::Vector2f velocity);
+
+	// kills particles which lived at least given time
+	void killOldParticles(RangeId, float wholeLifetime);
+
+	// moves particles and interpolates their colors from start color to end color during whole lifetime
+	void update(RangeId, float dt, sf::Vector2f acceleration, Vector4f startColor, Vector4f endColor, float wholeLifetime);
+
+	// appends quads of particles of the range from the oldest one, color is the only thing which varies between them
+	void appendQuads(RangeId, sf::Vector2f positionOffset, sf::Vector2f size, std::vector<QuadData>& quads) const;
+
+	unsigned getNrOfParticles(RangeId) const;
+	float getLifetimeOfNewestParticle(RangeId) const;
+
+	// number of particles which can be kept in the arena, freed ranges are reused before it grows
+	size_t getCapacity() const { return mLifetimes.size(); }
+	size_t getNrOfRanges() const { return mRanges.size() - mFreeRangeIds.size(); }
+
+private:
+	struct Range
+	{
+		unsigned first;
+		unsigned capacity;
+		unsigned oldest;
+		unsigned count;
+	};
+
+	struct FreeBlock
+	{
+		unsigned first;
+		unsigned capacity;
+	};
+
+	// ring of the range is split into at most two contiguous parts, oldest particles are in the first one
+	template<typename Function>
+	void forEachPart(const Range&, Function) const;
+
+	unsigned getIndexOfNewest(const Range&) const;
+
+private:
+	std::vector<float> mPositionsX;
+	std::vector<float> mPositionsY;
+	std::vector<float> mVelocitiesX;
+	std::vector<float> mVelocitiesY;
+	std::vector<float> mLifetimes;
+	std::vector<Vector4f> mColors;
+	std::vector<Range> mRanges;
+	std::vector<RangeId> mFreeRangeIds;
+	// sorted by first index, adjacent blocks are merged
+	std::vector<FreeBlock> mFreeBlocks;
+};
+
+}
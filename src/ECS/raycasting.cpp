@@ -0,0 +1,76 @@
+#include "raycasting.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace ph {
+
+float getRayDistanceToRect(sf::Vector2f origin, sf::Vector2f direction, const FloatRect& rect, float maxDistance)
+{
+	// ray is clipped by slabs between opposite edges of the rect
+	float entry = 0.f;
+	float exit = maxDistance;
+
+	auto clipBySlab = [&entry, &exit](float origin, float direction, float slabMin, float slabMax) {
+		if(direction == 0.f)
+			return origin >= slabMin && origin <= slabMax;
+
+		float slabEntry = (slabMin - origin) / direction;
+		float slabExit = (slabMax - origin) / direction;
+		if(slabEntry > slabExit)
+			std::swap(slabEntry, slabExit);
+		entry = std::max(entry, slabEntry);
+		exit = std::min(exit, slabExit);
+		return entry <= exit;
+	};
+
+	if(clipBySlab(origin.x, direction.x, rect.left, rect.right()) && clipBySlab(origin.y, direction.y, rect.top, rect.bottom()))
+		return entry;
+	return maxDistance;
+}
+
+float getRayDistanceToSolidTile(sf::Vector2f origin, sf::Vector2f direction, const component::TileCollisionBitmap& bitmap, float maxDistance)
+{
+	constexpr float infinity = std::numeric_limits<float>::infinity();
+
+	// ray is walked in tile units, distances stay in lengths of direction vector
+	const sf::Vector2f start(origin.x / bitmap.tileSize.x, origin.y / bitmap.tileSize.y);
+	const sf::Vector2f dir(direction.x / bitmap.tileSize.x, direction.y / bitmap.tileSize.y);
+
+	int tileX = static_cast<int>(std::floor(start.x));
+	int tileY = static_cast<int>(std::floor(start.y));
+	const int stepX = dir.x > 0.f ? 1 : -1;
+	const int stepY = dir.y > 0.f ? 1 : -1;
+
+	// distance needed to cross one tile and distance to the first tile border
+	const float deltaX = dir.x != 0.f ? std::abs(1.f / dir.x) : infinity;
+	const float deltaY = dir.y != 0.f ? std::abs(1.f / dir.y) : infinity;
+	float nextBorderX = dir.x != 0.f ? (dir.x > 0.f ? tileX + 1 - start.x : start.x - tileX) * deltaX : infinity;
+	float nextBorderY = dir.y != 0.f ? (dir.y > 0.f ? tileY + 1 - start.y : start.y - tileY) * deltaY : infinity;
+
+	float distance = 0.f;
+	while(distance < maxDistance)
+	{
+		const bool isInsideMap = tileX >= 0 && tileY >= 0 &&
+			static_cast<unsigned>(tileX) < bitmap.mapSize.x && static_cast<unsigned>(tileY) < bitmap.mapSize.y;
+		if(isInsideMap && bitmap.isSolid(tileX, tileY))
+			return distance;
+
+		if(nextBorderX < nextBorderY)
+		{
+			distance = nextBorderX;
+			nextBorderX += deltaX;
+			tileX += stepX;
+		}
+		else
+		{
+			distance = nextBorderY;
+			nextBorderY += deltaY;
+			tileY += stepY;
+		}
+	}
+	return maxDistance;
+}
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "ECS/Components/physicsComponents.hpp"
+#include "Utilities/rect.hpp"
+#include <SFML/System/Vector2.hpp>
+
+namespace ph {
+
+// Distances are measured in lengths of direction vector, so point of hit is origin + direction * distance.
+// Both functions return maxDistance if ray doesn't hit anything closer, so they can be chained
+// to find the closest hit: distance = getRayDistanceToRect(origin, direction, rect, distance);
+
+// distance at which ray enters the rect, 0 if origin is inside of it
+float getRayDistanceToRect(sf::Vector2f origin, sf::Vector2f direction, const FloatRect&, float maxDistance);
+
+// walks only through tiles which ray crosses (DDA) and returns distance at which it enters the first solid one
+float getRayDistanceToSolidTile(sf::Vector2f origin, sf::Vector2f direction, const component::TileCollisionBitmap&, float maxDistance);
+
+}
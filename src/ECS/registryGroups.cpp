@@ -0,0 +1,13 @@
+#include "registryGroups.hpp"
+
+namespace ph::Groups {
+
+void createGroups(entt::registry& registry)
+{
+	movingBodies(registry);
+	kinematicBodies(registry);
+	renderQuads(registry);
+	zombies(registry);
+}
+
+}
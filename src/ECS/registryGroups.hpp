@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+#include "ECS/Components/animationComponents.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/aiComponents.hpp"
+#include <entt/entity/registry.hpp>
+
+namespace ph::Groups {
+
+// Groups of the hottest component combinations. Components owned by a group are packed at the beginning
+// of their pools in the same order, so systems iterate them like arrays instead of looking up sparse sets.
+//
+// Groups are declared only here, because entt creates another group for the same components given in other order
+// and component can be owned by many groups only if these groups are nested in each other.
+// Pools of owned components can't be sorted and components can't be assigned or removed while owned pool is iterated.
+// Assigning or removing any component of a group moves owned components of the entity, so systems which do it
+// have to declare owned components as written.
+
+// owns BodyRect and Velocity, used by Movement
+inline auto movingBodies(entt::registry& registry)
+{
+	return registry.group<component::BodyRect, component::Velocity>(entt::exclude<component::Sleeping>);
+}
+
+// nested in movingBodies, so these entities are packed at the beginning of movingBodies, used by KinematicCollisions
+inline auto kinematicBodies(entt::registry& registry)
+{
+	return registry.group<component::BodyRect, component::Velocity, component::KinematicCollisionBody>(entt::exclude<component::Sleeping>);
+}
+
+// owns only RenderQuad, because BodyRect is owned by moving bodies, used by RenderSystem
+inline auto renderQuads(entt::registry& registry)
+{
+	return registry.group<component::RenderQuad>(entt::get<component::BodyRect>, entt::exclude<component::HiddenForRenderer>);
+}
+
+// owns only Zombie, because Velocity is owned by moving bodies, used by ZombieSystem
+inline auto zombies(entt::registry& registry)
+{
+	return registry.group<component::Zombie>(entt::get<component::CharacterSpeed, component::Velocity, component::AnimationData>,
+	                                         entt::exclude<component::DeadCharacter>);
+}
+
+// groups are created lazily by functions above, scene creates them before entities so components are packed while they are assigned
+void createGroups(entt::registry&);
+
+}
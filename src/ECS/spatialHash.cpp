@@ -0,0 +1,108 @@
+#include "spatialHash.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ph {
+
+SpatialHash::SpatialHash(float cellSize)
+	:mCellSize(cellSize)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(cellSize > 0.f, "Cell size of SpatialHash has to be positive!");
+}
+
+void SpatialHash::insertOrUpdate(entt::entity entity, const FloatRect& rect)
+{
+	const CellsRange cells = getCellsRange(rect);
+	auto found = mEntitiesCells.find(entity);
+	if(found == mEntitiesCells.end()) {
+		mEntitiesCells.emplace(entity, cells);
+		addToCells(entity, cells);
+	}
+	else if(!(found->second == cells)) {
+		removeFromCells(entity, found->second);
+		addToCells(entity, cells);
+		found->second = cells;
+	}
+}
+
+void SpatialHash::remove(entt::entity entity)
+{
+	auto found = mEntitiesCells.find(entity);
+	if(found != mEntitiesCells.end()) {
+		removeFromCells(entity, found->second);
+		mEntitiesCells.erase(found);
+	}
+}
+
+void SpatialHash::clear()
+{
+	mCells.clear();
+	mEntitiesCells.clear();
+}
+
+void SpatialHash::queryRect(const FloatRect& rect, std::vector<entt::entity>& result) const
+{
+	result.clear();
+	const CellsRange cells = getCellsRange(rect);
+	for(int y = cells.top; y <= cells.bottom; ++y)
+		for(int x = cells.left; x <= cells.right; ++x)
+		{
+			auto cell = mCells.find(getCellKey(x, y));
+			if(cell != mCells.end())
+				result.insert(result.end(), cell->second.begin(), cell->second.end());
+		}
+
+	std::sort(result.begin(), result.end());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+void SpatialHash::queryPoint(sf::Vector2f point, std::vector<entt::entity>& result) const
+{
+	result.clear();
+	const int x = static_cast<int>(std::floor(point.x / mCellSize));
+	const int y = static_cast<int>(std::floor(point.y / mCellSize));
+	auto cell = mCells.find(getCellKey(x, y));
+	if(cell != mCells.end()) {
+		result = cell->second;
+		std::sort(result.begin(), result.end());
+	}
+}
+
+auto SpatialHash::getCellsRange(const FloatRect& rect) const -> CellsRange
+{
+	return {
+		static_cast<int>(std::floor(rect.left / mCellSize)),
+		static_cast<int>(std::floor(rect.top / mCellSize)),
+		static_cast<int>(std::floor(rect.right() / mCellSize)),
+		static_cast<int>(std::floor(rect.bottom() / mCellSize))
+	};
+}
+
+long long SpatialHash::getCellKey(int x, int y)
+{
+	return (static_cast<long long>(x) << 32) | static_cast<unsigned>(y);
+}
+
+void SpatialHash::addToCells(entt::entity entity, const CellsRange& cells)
+{
+	for(int y = cells.top; y <= cells.bottom; ++y)
+		for(int x = cells.left; x <= cells.right; ++x)
+			mCells[getCellKey(x, y)].emplace_back(entity);
+}
+
+void SpatialHash::removeFromCells(entt::entity entity, const CellsRange& cells)
+{
+	for(int y = cells.top; y <= cells.bottom; ++y)
+		for(int x = cells.left; x <= cells.right; ++x)
+		{
+			auto& cell = mCells[getCellKey(x, y)];
+			auto found = std::find(cell.begin(), cell.end(), entity);
+			if(found != cell.end()) {
+				*found = cell.back();
+				cell.pop_back();
+			}
+		}
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Utilities/rect.hpp"
+#include <entt/entity/registry.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace ph {
+
+// Uniform grid which maps world cells to entities which rects overlap them.
+// It's broad phase - queries return entities which are in cells overlapped by the query,
+// so callers still have to test actual rects of returned entities.
+//
+// Scene keeps one instance as registry context variable. SpatialHashUpdate system puts there
+// BodyRects of all entities and shared bounds of MultiStaticCollisionBodies before every fixed step.
+
+class SpatialHash
+{
+public:
+	explicit SpatialHash(float cellSize = 64.f);
+
+	// moves entity between cells only if rect overlaps other cells than the last time
+	void insertOrUpdate(entt::entity, const FloatRect&);
+	void remove(entt::entity);
+	void clear();
+
+	// results are sorted and every entity is there only once
+	void queryRect(const FloatRect&, std::vector<entt::entity>& result) const;
+	void queryPoint(sf::Vector2f, std::vector<entt::entity>& result) const;
+
+	bool contains(entt::entity entity) const { return mEntitiesCells.find(entity) != mEntitiesCells.end(); }
+	size_t getNrOfEntities() const { return mEntitiesCells.size(); }
+	float getCellSize() const { return mCellSize; }
+
+private:
+	struct CellsRange
+	{
+		int left, top, right, bottom;
+
+		bool operator==(const CellsRange& r) const { return left == r.left && top == r.top && right == r.right && bottom == r.bottom; }
+	};
+
+	CellsRange getCellsRange(const FloatRect&) const;
+	static long long getCellKey(int x, int y);
+
+	void addToCells(entt::entity, const CellsRange&);
+	void removeFromCells(entt::entity, const CellsRange&);
+
+private:
+	std::unordered_map<long long, std::vector<entt::entity>> mCells;
+	std::unordered_map<entt::entity, CellsRange> mEntitiesCells;
+	float mCellSize;
+};
+
+}
@@ -0,0 +1,118 @@
+#include "sweepAndPrune.hpp"
+#include <algorithm>
+#include <type_traits>
+
+namespace ph {
+
+void SweepAndPrune::setBody(entt::entity entity, const FloatRect& rect)
+{
+	const size_t index = getIndex(entity);
+	if(index >= mBodies.size())
+		mBodies.resize(index + 1);
+
+	Body& body = mBodies[index];
+	if(body.entity != entity)
+	{
+		// endpoints of destroyed entity with the same index are removed in update()
+		body.entity = entity;
+		mEndpoints.push_back({0.f, entity, true});
+		mEndpoints.push_back({0.f, entity, false});
+		mNrOfNewEndpoints += 2;
+	}
+	body.rect = rect;
+	body.lastUpdate = mNrOfUpdates + 1;
+}
+
+void SweepAndPrune::update()
+{
+	++mNrOfUpdates;
+	removeOldBodies();
+
+	for(auto& endpoint : mEndpoints)
+	{
+		const FloatRect& rect = mBodies[getIndex(endpoint.entity)].rect;
+		endpoint.value = endpoint.isMin ? rect.left : rect.right();
+	}
+
+	sortEndpoints();
+	sweep();
+}
+
+size_t SweepAndPrune::getIndex(entt::entity entity)
+{
+	using Traits = entt::entt_traits<std::underlying_type_t<entt::entity>>;
+	return static_cast<size_t>(entt::to_integer(entity) & Traits::entity_mask);
+}
+
+void SweepAndPrune::removeOldBodies()
+{
+	auto newEnd = std::remove_if(mEndpoints.begin(), mEndpoints.end(), [this](const Endpoint& endpoint) {
+		Body& body = mBodies[getIndex(endpoint.entity)];
+		if(body.entity != endpoint.entity)
+			return true;
+		if(body.lastUpdate != mNrOfUpdates) {
+			body.entity = entt::null;
+			return true;
+		}
+		return false;
+	});
+
+	// new endpoints are at the end and are never removed, because they were set in this update
+	mEndpoints.erase(newEnd, mEndpoints.end());
+}
+
+void SweepAndPrune::sortEndpoints()
+{
+	const auto firstNewEndpoint = mEndpoints.end() - mNrOfNewEndpoints;
+
+	// old endpoints are almost sorted
+	for(auto it = mEndpoints.begin(); it != firstNewEndpoint; ++it)
+	{
+		Endpoint endpoint = *it;
+		auto position = it;
+		for(; position != mEndpoints.begin() && endpoint < *(position - 1); --position)
+			*position = *(position - 1);
+		*position = endpoint;
+	}
+
+	// new ones can be anywhere, so after the first update all bodies aren't insertion sorted
+	std::sort(firstNewEndpoint, mEndpoints.end());
+	std::inplace_merge(mEndpoints.begin(), firstNewEndpoint, mEndpoints.end());
+	mNrOfNewEndpoints = 0;
+}
+
+void SweepAndPrune::sweep()
+{
+	mOverlappingPairs.clear();
+	mActiveBodies.clear();
+
+	for(const auto& endpoint : mEndpoints)
+	{
+		const FloatRect& rect = mBodies[getIndex(endpoint.entity)].rect;
+
+		// max of body with zero width can be before its min, such body doesn't overlap anything anyway
+		if(rect.width <= 0.f)
+			continue;
+
+		if(endpoint.isMin)
+		{
+			for(auto active : mActiveBodies)
+			{
+				const FloatRect& activeRect = mBodies[getIndex(active)].rect;
+				if(rect.top < activeRect.bottom() && rect.bottom() > activeRect.top)
+					mOverlappingPairs.emplace_back(std::min(active, endpoint.entity), std::max(active, endpoint.entity));
+			}
+			mActiveBodies.emplace_back(endpoint.entity);
+		}
+		else
+		{
+			auto found = std::find(mActiveBodies.begin(), mActiveBodies.end(), endpoint.entity);
+			*found = mActiveBodies.back();
+			mActiveBodies.pop_back();
+		}
+	}
+
+	std::sort(mOverlappingPairs.begin(), mOverlappingPairs.end());
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Utilities/rect.hpp"
+#include <entt/entity/registry.hpp>
+#include <vector>
+#include <utility>
+
+namespace ph {
+
+// Broad phase which keeps min and max x of every body sorted between updates.
+// Bodies move only a little during one step, so endpoints are almost sorted and insertion sort
+// has to do very few swaps. Sweep along x axis gives pairs which overlap on both axes.
+//
+// Usage:
+//   for(auto entity : bodies)
+//       sweepAndPrune.setBody(entity, bodies.get<component::BodyRect>(entity).rect);
+//   sweepAndPrune.update();
+//   for(auto [first, second] : sweepAndPrune.getOverlappingPairs())
+//       ...
+
+class SweepAndPrune
+{
+public:
+	// has to be called for every body before every update, bodies which weren't set are removed
+	void setBody(entt::entity, const FloatRect&);
+
+	void update();
+
+	// first entity of the pair is always smaller, pairs are sorted
+	const std::vector<std::pair<entt::entity, entt::entity>>& getOverlappingPairs() const { return mOverlappingPairs; }
+
+	size_t getNrOfBodies() const { return mEndpoints.size() / 2; }
+
+private:
+	struct Body
+	{
+		entt::entity entity = entt::null;
+		FloatRect rect;
+		unsigned long long lastUpdate = 0;
+	};
+
+	struct Endpoint
+	{
+		float value;
+		entt::entity entity;
+		bool isMin;
+
+		bool operator<(const Endpoint& e) const
+		{
+			// rects which only touch don't overlap, so max goes first
+			return value < e.value || (value == e.value && !isMin && e.isMin);
+		}
+	};
+
+	static size_t getIndex(entt::entity);
+
+	void removeOldBodies();
+	void sortEndpoints();
+	void sweep();
+
+private:
+	std::vector<Body> mBodies;
+	std::vector<Endpoint> mEndpoints;
+	std::vector<entt::entity> mActiveBodies;
+	std::vector<std::pair<entt::entity, entt::entity>> mOverlappingPairs;
+	size_t mNrOfNewEndpoints = 0;
+	unsigned long long mNrOfUpdates = 0;
+};
+
+}
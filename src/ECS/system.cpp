@@ -11,4 +11,9 @@ namespace ph::system {
 	{
 	}
 
+	void System::declareAccess(SystemAccess& access) const
+	{
+		access.runsExclusively();
+	}
+
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Events/event.hpp"
+#include "systemAccess.hpp"
 
 #include <entt/entity/registry.hpp>
 
@@ -12,8 +13,12 @@ namespace ph::system {
 		explicit System(entt::registry& registry);
 
 		virtual void update(float seconds) = 0;
+		// called only with actions which are declared by access.receivesActions<>()
 		virtual void onEvent(const ActionEvent& event);
 
+		// systems which don't declare their access run exclusively on the main thread
+		virtual void declareAccess(SystemAccess&) const;
+
 	protected:
 		entt::registry& mRegistry;
 	};
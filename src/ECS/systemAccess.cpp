@@ -0,0 +1,60 @@
+#include "systemAccess.hpp"
+#include <algorithm>
+
+namespace ph {
+
+namespace {
+	struct RendererScene {};
+
+	bool haveCommonType(const std::vector<std::type_index>& a, const std::vector<std::type_index>& b)
+	{
+		for(auto& type : a)
+			if(std::find(b.begin(), b.end(), type) != b.end())
+				return true;
+		return false;
+	}
+}
+
+SystemAccess& SystemAccess::submitsToRenderer()
+{
+	// submissions of many threads are merged at the end of the frame but they can't be made before beginScene()
+	mReads.emplace_back(typeid(RendererScene));
+	return *this;
+}
+
+SystemAccess& SystemAccess::beginsRendererScene()
+{
+	mWrites.emplace_back(typeid(RendererScene));
+	return runsOnMainThread();
+}
+
+SystemAccess& SystemAccess::runsOnMainThread()
+{
+	mMustRunOnMainThread = true;
+	return *this;
+}
+
+SystemAccess& SystemAccess::runsExclusively()
+{
+	// nothing else is updated at that time anyway, and main thread is the safest place for unknown work
+	mIsExclusive = true;
+	return runsOnMainThread();
+}
+
+bool SystemAccess::conflictsWith(const SystemAccess& other) const
+{
+	if(mIsExclusive || other.mIsExclusive)
+		return true;
+
+	return haveCommonType(mWrites, other.mWrites) ||
+	       haveCommonType(mWrites, other.mReads) ||
+	       haveCommonType(mReads, other.mWrites);
+}
+
+void SystemAccess::preparePools(entt::registry& registry) const
+{
+	for(auto preparePool : mPoolPreparers)
+		preparePool(registry);
+}
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "eventQueue.hpp"
+#include "Events/actionEvent.hpp"
+#include <entt/entity/registry.hpp>
+#include <typeindex>
+#include <vector>
+
+namespace ph {
+
+// Describes what the system touches during update().
+// SystemsQueue runs two systems at the same time only if their accesses don't conflict,
+// so everything what update() reads or writes has to be declared here.
+
+class SystemAccess
+{
+public:
+	template<typename... Components>
+	SystemAccess& reads();
+
+	template<typename... Components>
+	SystemAccess& writes();
+
+	// objects shared by many systems which aren't components, for example GUI or AIManager
+	template<typename... Objects>
+	SystemAccess& uses();
+
+	// shared objects which update() only reads, systems which only read them can be updated at the same time
+	template<typename... Objects>
+	SystemAccess& usesReadOnly();
+
+	// events are sent through EventQueue<Event> registry context variables, see eventQueue.hpp
+	template<typename... Events>
+	SystemAccess& emits();
+
+	template<typename... Events>
+	SystemAccess& receives();
+
+	// onEvent() is called only with action events of these actions
+	template<ActionId... Actions>
+	SystemAccess& receivesActions();
+
+	SystemAccess& submitsToRenderer();
+	SystemAccess& beginsRendererScene();
+	SystemAccess& runsOnMainThread();
+
+	// for systems which create or destroy entities or touch components which aren't declared
+	SystemAccess& runsExclusively();
+
+	bool conflictsWith(const SystemAccess&) const;
+
+	// pools and event queues can't be created while other threads are using registry
+	void preparePools(entt::registry&) const;
+
+	// SystemsQueue uses them to decide when event queues are cleared
+	struct EmittedEvents
+	{
+		std::type_index queueType;
+		void(*clearQueue)(entt::registry&);
+	};
+	const std::vector<EmittedEvents>& getEmittedEvents() const { return mEmittedEvents; }
+	const std::vector<std::type_index>& getReceivedEvents() const { return mReceivedEvents; }
+	const std::vector<ActionId>& getReceivedActions() const { return mReceivedActions; }
+
+	bool isExclusive() const { return mIsExclusive; }
+	bool mustRunOnMainThread() const { return mMustRunOnMainThread; }
+
+private:
+	std::vector<std::type_index> mReads;
+	std::vector<std::type_index> mWrites;
+	std::vector<void(*)(entt::registry&)> mPoolPreparers;
+	std::vector<EmittedEvents> mEmittedEvents;
+	std::vector<std::type_index> mReceivedEvents;
+	std::vector<ActionId> mReceivedActions;
+	bool mIsExclusive = false;
+	bool mMustRunOnMainThread = false;
+};
+
+}
+
+#include "systemAccess.inl"
@@ -0,0 +1,59 @@
+namespace ph {
+
+template<typename... Components>
+SystemAccess& SystemAccess::reads()
+{
+	(mReads.emplace_back(typeid(Components)), ...);
+	(mPoolPreparers.emplace_back([](entt::registry& registry) { registry.prepare<Components>(); }), ...);
+	return *this;
+}
+
+template<typename... Components>
+SystemAccess& SystemAccess::writes()
+{
+	(mWrites.emplace_back(typeid(Components)), ...);
+	(mPoolPreparers.emplace_back([](entt::registry& registry) { registry.prepare<Components>(); }), ...);
+	return *this;
+}
+
+template<typename... Objects>
+SystemAccess& SystemAccess::uses()
+{
+	(mWrites.emplace_back(typeid(Objects)), ...);
+	return *this;
+}
+
+template<typename... Events>
+SystemAccess& SystemAccess::emits()
+{
+	(mWrites.emplace_back(typeid(EventQueue<Events>)), ...);
+	(mPoolPreparers.emplace_back([](entt::registry& registry) { registry.ctx_or_set<EventQueue<Events>>(); }), ...);
+	(mEmittedEvents.push_back({typeid(EventQueue<Events>), [](entt::registry& registry) { registry.ctx<EventQueue<Events>>().clear(); }}), ...);
+	return *this;
+}
+
+template<typename... Events>
+SystemAccess& SystemAccess::receives()
+{
+	(mReads.emplace_back(typeid(EventQueue<Events>)), ...);
+	(mPoolPreparers.emplace_back([](entt::registry& registry) { registry.ctx_or_set<EventQueue<Events>>(); }), ...);
+	(mReceivedEvents.emplace_back(typeid(EventQueue<Events>)), ...);
+	return *this;
+}
+
+template<ActionId... Actions>
+SystemAccess& SystemAccess::receivesActions()
+{
+	// action events are handled on the main thread between updates, so they don't conflict with anything
+	(mReceivedActions.emplace_back(Actions), ...);
+	return *this;
+}
+
+template<typename... Objects>
+SystemAccess& SystemAccess::usesReadOnly()
+{
+	(mReads.emplace_back(typeid(Objects)), ...);
+	return *this;
+}
+
+}
@@ -1,22 +1,257 @@
 #include "systemsQueue.hpp"
+#include "Utilities/jobSystem.hpp"
+#include "Utilities/profiling.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <limits>
 
 namespace ph {
 	
-	SystemsQueue::SystemsQueue(entt::registry& registry)
+	SystemsQueue::SystemsQueue(entt::registry& registry, JobSystem* jobSystem)
 		: mRegistry(registry)
+		, mJobSystem(jobSystem)
 	{
+		mRegistry.set<FixedStepInterpolation>();
+	}
+
+	JobSystem* SystemsQueue::getDefaultJobSystem()
+	{
+	#if PH_PARALLEL_SYSTEMS
+		return &JobSystem::getInstance();
+	#else
+		return nullptr;
+	#endif
 	}
 
 	void SystemsQueue::update(float seconds)
 	{
-		for (auto& system : mSystemsArray)
-			system->update(seconds);
+		PH_PROFILE_FUNCTION();
+
+		if(mIsDependencyGraphOutdated) {
+			buildDependencyGraph(mFixedStepSystems);
+			buildDependencyGraph(mFrameSystems);
+			assignEventQueuesToStages();
+			mIsDependencyGraphOutdated = false;
+		}
+
+		mTimeAccumulator += seconds;
+		unsigned nrOfSteps = 0;
+		while(mTimeAccumulator >= mFixedTimeStep && nrOfSteps < mMaxNrOfFixedStepsPerFrame) {
+			updateStage(mFixedStepSystems, mFixedTimeStep);
+			clearEventQueues(mFixedStepEventQueuesClearers);
+			mTimeAccumulator -= mFixedTimeStep;
+			++nrOfSteps;
+		}
+		if(mTimeAccumulator >= mFixedTimeStep)
+			mTimeAccumulator = std::fmod(mTimeAccumulator, mFixedTimeStep);
+
+		mRegistry.ctx<FixedStepInterpolation>().factor = mTimeAccumulator / mFixedTimeStep;
+		updateStage(mFrameSystems, seconds);
+		clearEventQueues(mFrameEventQueuesClearers);
 	}
 
 	void SystemsQueue::handleEvents(const ActionEvent& event)
 	{
-		for (auto& system : mSystemsArray)
+		for(auto* system : mActionReceivers[static_cast<size_t>(event.mAction)])
 			system->onEvent(event);
 	}
 
+	unsigned SystemsQueue::getLeastBusyPhase(const Stage& stage, unsigned updateInterval)
+	{
+		// two systems are updated at the same time from time to time if their phases are equal modulo gcd of their intervals
+		unsigned leastBusyPhase = 0;
+		size_t leastNrOfCollisions = std::numeric_limits<size_t>::max();
+		for(unsigned phase = 0; phase < updateInterval; ++phase)
+		{
+			size_t nrOfCollisions = 0;
+			for(auto& scheduled : stage.systems) {
+				const unsigned gcd = std::gcd(updateInterval, scheduled.updateInterval);
+				if(scheduled.updateInterval > 1 && phase % gcd == scheduled.updatePhase % gcd)
+					++nrOfCollisions;
+			}
+			if(nrOfCollisions < leastNrOfCollisions) {
+				leastNrOfCollisions = nrOfCollisions;
+				leastBusyPhase = phase;
+			}
+		}
+		return leastBusyPhase;
+	}
+
+	void SystemsQueue::buildDependencyGraph(Stage& stage)
+	{
+		// system depends on every system appended before it which access conflicts with its access,
+		// thanks to that conflicting systems are updated in the same order as they would be updated sequentially
+		// fixed step systems and frame systems are never updated at the same time, so they don't depend on each other
+		auto& systems = stage.systems;
+		for(auto& scheduled : systems) {
+			scheduled.dependents.clear();
+			scheduled.nrOfDependencies = 0;
+		}
+
+		for(size_t later = 0; later < systems.size(); ++later)
+			for(size_t earlier = 0; earlier < later; ++earlier)
+				if(systems[later].access.conflictsWith(systems[earlier].access)) {
+					systems[earlier].dependents.emplace_back(later);
+					++systems[later].nrOfDependencies;
+				}
+
+		// registry adds pools on the first access, which isn't safe while many systems are updated
+		for(auto& scheduled : systems)
+			scheduled.access.preparePools(mRegistry);
+	}
+
+	void SystemsQueue::assignEventQueuesToStages()
+	{
+		mFixedStepEventQueuesClearers.clear();
+		mFrameEventQueuesClearers.clear();
+
+		auto isUsedByFrameSystems = [this](std::type_index queueType) {
+			for(auto& scheduled : mFrameSystems.systems) {
+				const auto& received = scheduled.access.getReceivedEvents();
+				if(std::find(received.begin(), received.end(), queueType) != received.end())
+					return true;
+				for(auto& emitted : scheduled.access.getEmittedEvents())
+					if(emitted.queueType == queueType)
+						return true;
+			}
+			return false;
+		};
+
+		std::vector<std::type_index> assignedQueues;
+		for(auto* stage : {&mFixedStepSystems, &mFrameSystems})
+			for(auto& scheduled : stage->systems)
+				for(auto& emitted : scheduled.access.getEmittedEvents())
+				{
+					if(std::find(assignedQueues.begin(), assignedQueues.end(), emitted.queueType) != assignedQueues.end())
+						continue;
+					assignedQueues.emplace_back(emitted.queueType);
+
+					// events of fixed steps which frame systems receive wait until the end of the frame
+					if(isUsedByFrameSystems(emitted.queueType))
+						mFrameEventQueuesClearers.emplace_back(emitted.clearQueue);
+					else
+						mFixedStepEventQueuesClearers.emplace_back(emitted.clearQueue);
+				}
+	}
+
+	void SystemsQueue::clearEventQueues(const std::vector<void(*)(entt::registry&)>& queuesClearers)
+	{
+		for(auto clearQueue : queuesClearers)
+			clearQueue(mRegistry);
+	}
+
+	void SystemsQueue::updateStage(Stage& stage, float seconds)
+	{
+		for(auto& scheduled : stage.systems) {
+			scheduled.timeSinceLastUpdate += seconds;
+			scheduled.isDue = stage.nrOfUpdates % scheduled.updateInterval == scheduled.updatePhase;
+		}
+		++stage.nrOfUpdates;
+
+		if(mJobSystem && mJobSystem->getNrOfWorkers() > 0 && stage.systems.size() > 1)
+			updateInParallel(stage);
+		else
+			updateSequentially(stage);
+	}
+
+	void SystemsQueue::updateSequentially(Stage& stage)
+	{
+		for(auto& scheduled : stage.systems)
+			if(scheduled.isDue) {
+				scheduled.system->update(scheduled.timeSinceLastUpdate);
+				scheduled.timeSinceLastUpdate = 0.f;
+			}
+	}
+
+	void SystemsQueue::updateInParallel(Stage& stage)
+	{
+		auto& systems = stage.systems;
+		mUpdatedStage = &stage;
+		mNrOfRemainingDependencies.resize(systems.size());
+		for(size_t i = 0; i < systems.size(); ++i)
+			mNrOfRemainingDependencies[i] = systems[i].nrOfDependencies;
+		mNrOfUpdatedSystems = 0;
+		mException = nullptr;
+
+		for(size_t i = 0; i < systems.size(); ++i)
+			if(systems[i].nrOfDependencies == 0)
+				scheduleSystem(i);
+
+		// main thread updates systems which have to be updated on it and helps with the other jobs in the meantime
+		while(mNrOfUpdatedSystems < systems.size())
+		{
+			size_t index;
+			if(tryPopReadyMainThreadSystem(index))
+				updateSystem(index);
+			else if(!mJobSystem->tryRunOneJob())
+				std::this_thread::yield();
+		}
+
+		if(mException)
+			std::rethrow_exception(mException);
+	}
+
+	void SystemsQueue::updateSystem(size_t index)
+	{
+		auto& scheduled = mUpdatedStage->systems[index];
+
+		bool hasFailed;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			hasFailed = mException != nullptr;
+		}
+
+		// after exception remaining systems are only marked as updated, so main thread doesn't wait forever
+		if(!hasFailed && scheduled.isDue) {
+			try {
+				scheduled.system->update(scheduled.timeSinceLastUpdate);
+				scheduled.timeSinceLastUpdate = 0.f;
+			}
+			catch(...) {
+				std::lock_guard<std::mutex> lock(mMutex);
+				if(!mException)
+					mException = std::current_exception();
+			}
+		}
+
+		std::vector<size_t> readyDependents;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			for(size_t dependent : scheduled.dependents)
+				if(--mNrOfRemainingDependencies[dependent] == 0)
+					readyDependents.emplace_back(dependent);
+		}
+		for(size_t dependent : readyDependents)
+			scheduleSystem(dependent);
+
+		++mNrOfUpdatedSystems;
+	}
+
+	void SystemsQueue::scheduleSystem(size_t index)
+	{
+		const auto& scheduled = mUpdatedStage->systems[index];
+		if(!scheduled.isDue) {
+			// only releases its dependents
+			updateSystem(index);
+		}
+		else if(scheduled.access.mustRunOnMainThread()) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			mReadyMainThreadSystems.emplace_back(index);
+		}
+		else {
+			mJobSystem->push([this, index] { updateSystem(index); });
+		}
+	}
+
+	bool SystemsQueue::tryPopReadyMainThreadSystem(size_t& index)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if(mReadyMainThreadSystems.empty())
+			return false;
+		index = mReadyMainThreadSystems.front();
+		mReadyMainThreadSystems.pop_front();
+		return true;
+	}
+
 }
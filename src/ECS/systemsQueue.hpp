@@ -3,24 +3,123 @@
 #include "system.hpp"
 
 #include <vector>
+#include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <optional>
+
+// 1 - systems which access doesn't conflict are updated at the same time by the job system
+// 0 - systems are updated one after another on the main thread
+#define PH_PARALLEL_SYSTEMS 1
 
 namespace ph {
 
+	class JobSystem;
+
+	// registry context variable which is set by SystemsQueue before it updates frame systems,
+	// they can use it to interpolate between two last fixed steps (0 - previous step, 1 - last step)
+	struct FixedStepInterpolation
+	{
+		float factor = 1.f;
+	};
+
 	class SystemsQueue
 	{
 	public:
-		SystemsQueue(entt::registry& registry);
+		// when job system is nullptr or has no workers systems are updated on the calling thread only
+		SystemsQueue(entt::registry& registry, JobSystem* jobSystem = getDefaultJobSystem());
 
+		// updates fixed step systems once for every fixed time step which passed and then updates frame systems once
 		void update(float seconds);
+		// action event is given only to systems which receive its action
 		void handleEvents(const ActionEvent& event);
-	
+
+		// frame systems are updated once per update() with time of the whole frame
 		template <typename SystemType, typename... Args>
 		void appendSystem(Args... arguments);
 
+		// fixed step systems are always updated with the same time step, so gameplay doesn't depend on frame rate
+		template <typename SystemType, typename... Args>
+		void appendFixedStepSystem(Args... arguments);
+
+		void setFixedTimeStep(float seconds) { mFixedTimeStep = seconds; }
+		float getFixedTimeStep() const { return mFixedTimeStep; }
+
+		// when fixed steps take longer than the time they simulate the rest of frame time is dropped,
+		// so the game slows down instead of doing more and more steps every frame
+		void setMaxNrOfFixedStepsPerFrame(unsigned nrOfSteps) { mMaxNrOfFixedStepsPerFrame = nrOfSteps; }
+		unsigned getMaxNrOfFixedStepsPerFrame() const { return mMaxNrOfFixedStepsPerFrame; }
+
+		// system of given type is updated only once per nrOfUpdates updates of its stage and gets time which passed since its last update.
+		// Without given phase system gets the phase which is shared with the smallest number of other systems,
+		// so the cost of rarely updated systems is spread across frames.
+		template <typename SystemType>
+		void setUpdateInterval(unsigned nrOfUpdates, std::optional<unsigned> phase = std::nullopt);
+
+	private:
+		static JobSystem* getDefaultJobSystem();
+
+		struct ScheduledSystem
+		{
+			std::unique_ptr<system::System> system;
+			SystemAccess access;
+			// systems appended later which conflict with this one, they have to wait until it's updated
+			std::vector<size_t> dependents;
+			size_t nrOfDependencies = 0;
+			unsigned updateInterval = 1;
+			unsigned updatePhase = 0;
+			float timeSinceLastUpdate = 0.f;
+			bool isDue = true;
+		};
+
+		struct Stage
+		{
+			std::vector<ScheduledSystem> systems;
+			unsigned long long nrOfUpdates = 0;
+		};
+
+		template <typename SystemType, typename... Args>
+		void appendSystemToStage(Stage&, Args... arguments);
+
+		static unsigned getLeastBusyPhase(const Stage&, unsigned updateInterval);
+
+		void buildDependencyGraph(Stage&);
+		void assignEventQueuesToStages();
+		void clearEventQueues(const std::vector<void(*)(entt::registry&)>& queuesClearers);
+		void updateStage(Stage&, float seconds);
+		void updateSequentially(Stage&);
+		void updateInParallel(Stage&);
+		void updateSystem(size_t index);
+		void scheduleSystem(size_t index);
+		bool tryPopReadyMainThreadSystem(size_t& index);
+
 	private:
 		entt::registry& mRegistry;
-		std::vector<std::unique_ptr<system::System>> mSystemsArray;
+		JobSystem* mJobSystem;
+		Stage mFixedStepSystems;
+		Stage mFrameSystems;
+		float mFixedTimeStep = 1.f / 60.f;
+		float mTimeAccumulator = 0.f;
+		unsigned mMaxNrOfFixedStepsPerFrame = 5;
+		bool mIsDependencyGraphOutdated = false;
+
+		// queues of events which are used only by fixed step systems are cleared after every step, so events aren't received twice
+		std::vector<void(*)(entt::registry&)> mFixedStepEventQueuesClearers;
+		std::vector<void(*)(entt::registry&)> mFrameEventQueuesClearers;
+
+		// indexed by ActionId
+		std::array<std::vector<system::System*>, nrOfActions> mActionReceivers;
+
+		// state of the update which is in progress
+		Stage* mUpdatedStage = nullptr;
+		std::mutex mMutex;
+		std::vector<size_t> mNrOfRemainingDependencies;
+		std::deque<size_t> mReadyMainThreadSystems;
+		std::atomic<size_t> mNrOfUpdatedSystems{0};
+		std::exception_ptr mException;
 	};
 }
 
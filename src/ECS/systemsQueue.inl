@@ -4,7 +4,38 @@ namespace ph {
 	template<typename SystemType, typename... Args>
 	void SystemsQueue::appendSystem(Args... arguments)
 	{
-		mSystemsArray.emplace_back(std::unique_ptr<SystemType>(new SystemType(mRegistry, arguments...)));
+		appendSystemToStage<SystemType>(mFrameSystems, arguments...);
+	}
+
+	template<typename SystemType, typename... Args>
+	void SystemsQueue::appendFixedStepSystem(Args... arguments)
+	{
+		appendSystemToStage<SystemType>(mFixedStepSystems, arguments...);
+	}
+
+	template<typename SystemType, typename... Args>
+	void SystemsQueue::appendSystemToStage(Stage& stage, Args... arguments)
+	{
+		auto& scheduled = stage.systems.emplace_back();
+		scheduled.system = std::unique_ptr<SystemType>(new SystemType(mRegistry, arguments...));
+		scheduled.system->declareAccess(scheduled.access);
+		for(auto action : scheduled.access.getReceivedActions())
+			mActionReceivers[static_cast<size_t>(action)].emplace_back(scheduled.system.get());
+		mIsDependencyGraphOutdated = true;
+	}
+
+	template<typename SystemType>
+	void SystemsQueue::setUpdateInterval(unsigned nrOfUpdates, std::optional<unsigned> phase)
+	{
+		for(auto* stage : {&mFixedStepSystems, &mFrameSystems})
+			for(auto& scheduled : stage->systems)
+				if(dynamic_cast<SystemType*>(scheduled.system.get())) {
+					// system isn't counted as colliding with itself
+					scheduled.updateInterval = 1;
+					scheduled.updatePhase = phase ? *phase % nrOfUpdates : getLeastBusyPhase(*stage, nrOfUpdates);
+					scheduled.updateInterval = nrOfUpdates;
+					return;
+				}
 	}
 
 }
@@ -12,6 +12,7 @@
 #include "Scenes/CutScenes/subtitlesBeforeStartGameCutscene.hpp"
 #include "Scenes/CutScenes/endingCutscene.hpp"
 #include "Utilities/xml.hpp"
+#include "Utilities/rectsMerging.hpp"
 #include "Logs/logs.hpp"
 #include "Events/actionEventManager.hpp"
 #include "Renderer/API/shader.hpp"
@@ -45,6 +46,7 @@ namespace ph {
 			return;
 
 		loadObjects(gameObjects);
+		mergeLightWalls();
 
 		//mGameData->getAIManager().setIsPlayerOnScene(mHasLoadedPlayer);
 		ActionEventManager::setEnabled(true);
@@ -250,7 +252,7 @@ namespace ph {
 			const sf::Vector2f size = getSizeAttribute(cameraNode);
 			const sf::Vector2f center(pos + (size / 2.f));
 			camera.camera = Camera(center, size);
-			camera.name = getProperty(cameraNode, "name").toString();
+			camera.name = StringId::intern(getProperty(cameraNode, "name").toString());
 		}
 	}
 
@@ -391,6 +393,33 @@ namespace ph {
 		loadPositionAndSize(wallNode, entity);
 	}
 
+	void TiledParser::mergeLightWalls() const
+	{
+		// only walls which block light with their whole body, gates can be opened so they stay separate
+		std::vector<entt::entity> wallEntities;
+		std::vector<FloatRect> wallRects;
+		auto lightWalls = mGameRegistry.view<component::LightWall, component::BodyRect>(entt::exclude<component::Gate>);
+		for (auto entity : lightWalls)
+		{
+			const auto& [lightWall, body] = lightWalls.get<component::LightWall, component::BodyRect>(entity);
+			if (lightWall.rect.top == -1.f) {
+				wallEntities.emplace_back(entity);
+				wallRects.emplace_back(body.rect);
+			}
+		}
+
+		mergeAdjacentRects(wallRects);
+		PH_LOG_INFO("Light walls were merged from " + std::to_string(wallEntities.size()) + " to " + std::to_string(wallRects.size()) + " walls.");
+
+		for (size_t i = 0; i < wallEntities.size(); ++i)
+		{
+			if (i < wallRects.size())
+				mGameRegistry.get<component::BodyRect>(wallEntities[i]).rect = wallRects[i];
+			else
+				mGameRegistry.destroy(wallEntities[i]);
+		}
+	}
+
 	void TiledParser::loadFlowingRiver(const Xml& flowingRiverNode) const
 	{
 		auto entity = mTemplatesStorage.createCopy("FlowingRiver", mGameRegistry);
@@ -0,0 +1,83 @@
+#include "timerWheel.hpp"
+#include <cmath>
+#include <algorithm>
+
+namespace ph {
+
+TimerWheel::TimerWheel(float tickTime)
+	:mTickTime(tickTime)
+{
+}
+
+void TimerWheel::schedule(entt::entity entity, float delay, Callback callback)
+{
+	const auto nrOfTicks = static_cast<unsigned long long>(std::max(std::ceil(delay / mTickTime), 1.f));
+	insert({mCurrentTick + nrOfTicks, entity, callback, getGeneration(entity)});
+	++mNrOfPendingTimers;
+}
+
+void TimerWheel::cancel(entt::entity entity)
+{
+	// canceled timers stay in their slots and are dropped when they expire
+	++mGenerations[entity];
+}
+
+void TimerWheel::advance(float seconds, entt::registry& registry)
+{
+	mTimeAccumulator += seconds;
+	while(mTimeAccumulator >= mTickTime) {
+		mTimeAccumulator -= mTickTime;
+		tick(registry);
+	}
+}
+
+void TimerWheel::insert(const Timer& timer)
+{
+	const unsigned long long ticksLeft = timer.expirationTick - mCurrentTick;
+	for(unsigned level = 0; level < sNrOfLevels; ++level)
+		if(ticksLeft < 1ull << (sSlotBits * (level + 1))) {
+			const auto slot = (timer.expirationTick >> (sSlotBits * level)) & (sNrOfSlots - 1);
+			mLevels[level][slot].emplace_back(timer);
+			return;
+		}
+	mFarTimers.emplace_back(timer);
+}
+
+void TimerWheel::cascade(std::vector<Timer>& slot)
+{
+	// slot is swapped out first, because timers can be inserted back into it
+	mCascadedTimers.clear();
+	mCascadedTimers.swap(slot);
+	for(const auto& timer : mCascadedTimers)
+		insert(timer);
+}
+
+void TimerWheel::tick(entt::registry& registry)
+{
+	++mCurrentTick;
+
+	// when lower level wraps around, timers from the next slot of higher level are spread over lower levels
+	for(unsigned level = 1; level < sNrOfLevels; ++level) {
+		if(mCurrentTick & ((1ull << (sSlotBits * level)) - 1))
+			break;
+		cascade(mLevels[level][(mCurrentTick >> (sSlotBits * level)) & (sNrOfSlots - 1)]);
+		if(level == sNrOfLevels - 1 && (mCurrentTick & ((1ull << (sSlotBits * sNrOfLevels)) - 1)) == 0)
+			cascade(mFarTimers);
+	}
+
+	// callbacks are called after slot is emptied, so they can schedule timers
+	mExpiredTimers.clear();
+	mExpiredTimers.swap(mLevels[0][mCurrentTick & (sNrOfSlots - 1)]);
+	mNrOfPendingTimers -= mExpiredTimers.size();
+	for(const auto& timer : mExpiredTimers)
+		if(timer.generation == getGeneration(timer.entity) && registry.valid(timer.entity))
+			timer.callback(registry, timer.entity);
+}
+
+unsigned TimerWheel::getGeneration(entt::entity entity) const
+{
+	auto found = mGenerations.find(entity);
+	return found != mGenerations.end() ? found->second : 0;
+}
+
+}
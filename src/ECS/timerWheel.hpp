@@ -0,0 +1,73 @@
+#pragma once
+
+#include "eventQueue.hpp"
+#include <entt/entity/registry.hpp>
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace ph {
+
+// Hierarchical timer wheel which calls functions for entities after given time.
+// Timers are kept in slots of ticks instead of being counted down every frame, so advance() touches only
+// timers which expire, and timers which are far away are moved to lower levels 64 ticks at a time.
+//
+// Scene keeps one instance as registry context variable, Timers system advances it every fixed step.
+
+class TimerWheel
+{
+public:
+	using Callback = void(*)(entt::registry&, entt::entity);
+
+	explicit TimerWheel(float tickTime = 1.f / 60.f);
+
+	// callback is called once after at least given time, it isn't called if entity was destroyed or timers of entity were canceled
+	void schedule(entt::entity, float delay, Callback);
+
+	// sends Event{entity} through EventQueue<Event>
+	template<typename Event>
+	void scheduleEvent(entt::entity, float delay);
+
+	// timers of entity which stays alive but shouldn't get them anymore
+	void cancel(entt::entity);
+
+	// callbacks can schedule new timers
+	void advance(float seconds, entt::registry&);
+
+	size_t getNrOfPendingTimers() const { return mNrOfPendingTimers; }
+	float getTickTime() const { return mTickTime; }
+
+private:
+	struct Timer
+	{
+		unsigned long long expirationTick;
+		entt::entity entity;
+		Callback callback;
+		unsigned generation;
+	};
+
+	static constexpr unsigned sSlotBits = 6;
+	static constexpr unsigned sNrOfSlots = 1 << sSlotBits;
+	static constexpr unsigned sNrOfLevels = 4;
+
+	void insert(const Timer&);
+	void cascade(std::vector<Timer>& slot);
+	void tick(entt::registry&);
+	unsigned getGeneration(entt::entity) const;
+
+private:
+	std::array<std::array<std::vector<Timer>, sNrOfSlots>, sNrOfLevels> mLevels;
+	// timers which are further away than the last level reaches
+	std::vector<Timer> mFarTimers;
+	std::vector<Timer> mExpiredTimers;
+	std::vector<Timer> mCascadedTimers;
+	std::unordered_map<entt::entity, unsigned> mGenerations;
+	unsigned long long mCurrentTick = 0;
+	size_t mNrOfPendingTimers = 0;
+	const float mTickTime;
+	float mTimeAccumulator = 0.f;
+};
+
+}
+
+#include "timerWheel.inl"
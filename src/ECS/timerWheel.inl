@@ -0,0 +1,11 @@
+namespace ph {
+
+template<typename Event>
+void TimerWheel::scheduleEvent(entt::entity entity, float delay)
+{
+	schedule(entity, delay, [](entt::registry& registry, entt::entity entity) {
+		registry.ctx<EventQueue<Event>>().emit(entity);
+	});
+}
+
+}
@@ -10,6 +10,9 @@
 #include "Utilities/csv.hpp"
 #include "Utilities/filePath.hpp"
 #include "Utilities/math.hpp"
+#include "Utilities/rectsMerging.hpp"
+
+#include <cmath>
 
 namespace ph {
 
@@ -29,12 +32,23 @@ void XmlMapParser::parseFile(const std::string& fileName, AIManager& aiManager,
 	GeneralMapInfo generalMapInfo = getGeneralMapInfo(mapNode);
 	aiManager.registerMapSize(generalMapInfo.mapSize);
 
+	mCollisionBitmap.mapSize = generalMapInfo.mapSize;
+	mCollisionBitmap.tileSize = static_cast<sf::Vector2f>(generalMapInfo.tileSize);
+	mCollisionBitmap.solidTiles.assign(generalMapInfo.mapSize.x * generalMapInfo.mapSize.y, false);
+
 	const std::vector<Xml> tilesetNodes = getTilesetNodes(mapNode);
 	const TilesetsData tilesetsData = getTilesetsData(tilesetNodes);
 	const std::vector<Xml> layerNodes = getLayerNodes(mapNode);
 	
+	mNrOfCollisionRectsBeforeMerging = 0;
+	mNrOfCollisionRectsAfterMerging = 0;
 	parserMapLayers(layerNodes, tilesetsData, generalMapInfo, aiManager);
 	createMapBorders(generalMapInfo);
+	PH_LOG_INFO("Map collision rects which don't fill whole tiles were merged from " + std::to_string(mNrOfCollisionRectsBeforeMerging) +
+	            " to " + std::to_string(mNrOfCollisionRectsAfterMerging) + " rects.");
+
+	auto collisionBitmapEntity = mGameRegistry->create();
+	mGameRegistry->assign<component::TileCollisionBitmap>(collisionBitmapEntity, std::move(mCollisionBitmap));
 }
 
 void XmlMapParser::checkMapSupport(const Xml& mapNode) const
@@ -297,7 +311,8 @@ void XmlMapParser::createLayer(const std::vector<unsigned>& globalTileIds, const
 					bounds.left += qd.position.x;
 					bounds.top += qd.position.y;
 					aiManager.registerObstacle({bounds.left, bounds.top});
-					chunkCollisions[chunkIndex].rects.emplace_back(bounds);
+					if(!tryToPutIntoCollisionBitmap(bounds))
+						chunkCollisions[chunkIndex].rects.emplace_back(bounds);
 				}
 			}
 		}
@@ -313,6 +328,9 @@ void XmlMapParser::createLayer(const std::vector<unsigned>& globalTileIds, const
 
 		// put data for static collisions optimalization
 		chunkCollisions[i].sharedBounds = renderChunks[i].bounds;
+		mNrOfCollisionRectsBeforeMerging += chunkCollisions[i].rects.size();
+		mergeAdjacentRects(chunkCollisions[i].rects);
+		mNrOfCollisionRectsAfterMerging += chunkCollisions[i].rects.size();
 
 		// put data into registry
 		auto chunkEntity = mTemplates->createCopy("MapChunk", *mGameRegistry);
@@ -375,4 +393,25 @@ void XmlMapParser::createMapBorders(const GeneralMapInfo& mapInfo)
 	rightBody.rect = FloatRect(mapWidth, -tileSize.y, tileSize.x, mapHeight + 2 * tileSize.y);
 }
 
+bool XmlMapParser::tryToPutIntoCollisionBitmap(const FloatRect& bounds)
+{
+	const sf::Vector2f tileSize = mCollisionBitmap.tileSize;
+	const sf::Vector2f mapSize(mCollisionBitmap.mapSize.x * tileSize.x, mCollisionBitmap.mapSize.y * tileSize.y);
+
+	const bool isAlignedToTiles = std::fmod(bounds.left, tileSize.x) == 0.f && std::fmod(bounds.top, tileSize.y) == 0.f &&
+	                              std::fmod(bounds.width, tileSize.x) == 0.f && std::fmod(bounds.height, tileSize.y) == 0.f;
+	const bool isInsideMap = bounds.left >= 0.f && bounds.top >= 0.f && bounds.right() <= mapSize.x && bounds.bottom() <= mapSize.y;
+	if(!isAlignedToTiles || !isInsideMap || bounds.width <= 0.f || bounds.height <= 0.f)
+		return false;
+
+	const auto left = static_cast<unsigned>(bounds.left / tileSize.x);
+	const auto top = static_cast<unsigned>(bounds.top / tileSize.y);
+	const auto right = static_cast<unsigned>(bounds.right() / tileSize.x);
+	const auto bottom = static_cast<unsigned>(bounds.bottom() / tileSize.y);
+	for(unsigned y = top; y < bottom; ++y)
+		for(unsigned x = left; x < right; ++x)
+			mCollisionBitmap.solidTiles[y * mCollisionBitmap.mapSize.x + x] = true;
+	return true;
+}
+
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "entitiesTemplateStorage.hpp"
+#include "ECS/Components/physicsComponents.hpp"
 #include "Resources/resourceHolder.hpp"
 
 #include <entt/entity/registry.hpp>
@@ -59,7 +60,12 @@ private:
 	std::size_t findTilesIndex(const unsigned firstGlobalTileId, const std::vector<TilesData>& tilesData) const;
 	void createMapBorders(const GeneralMapInfo& mapInfo);
 
+	bool tryToPutIntoCollisionBitmap(const FloatRect& bounds);
+
 private:
+	component::TileCollisionBitmap mCollisionBitmap;
+	size_t mNrOfCollisionRectsBeforeMerging = 0;
+	size_t mNrOfCollisionRectsAfterMerging = 0;
 	entt::registry* mGameRegistry;
 	EntitiesTemplateStorage* mTemplates;
 	TextureHolder* mTextures;
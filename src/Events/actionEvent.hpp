@@ -1,17 +1,34 @@
 #pragma once
 
-#include <string>
+#include <cstddef>
 
 namespace ph {
 
+// actions are known at compile time, so events carry their ids and receivers don't compare action names
+enum class ActionId : unsigned char
+{
+	MovingUp,
+	MovingDown,
+	MovingRight,
+	MovingLeft,
+	Use,
+	ChangeWeapon,
+	GunAttack,
+	MeleeAttack,
+	PauseScreen,
+	Count
+};
+
+constexpr size_t nrOfActions = static_cast<size_t>(ActionId::Count);
+
 struct ActionEvent
 {
 	enum Type { Pressed, Released };
 
-	std::string mAction;
+	ActionId mAction;
 	Type mType;
 
-	ActionEvent(const std::string action, const Type type);
+	ActionEvent(const ActionId action, const Type type);
 };
 
 }
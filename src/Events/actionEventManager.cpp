@@ -11,76 +11,65 @@ void ActionEventManager::init()
 	//TODO: loading player's favorite controls from file
 
 	//setting up default moving actions
-	addAction("movingUp", {sf::Keyboard::W, sf::Keyboard::Up});
-	addAction("movingDown", {sf::Keyboard::S, sf::Keyboard::Down});
-	addAction("movingRight", {sf::Keyboard::D, sf::Keyboard::Right});
-	addAction("movingLeft", {sf::Keyboard::A, sf::Keyboard::Left});
-	addAction("use", sf::Keyboard::E);
-	addAction("changeWeapon", sf::Keyboard::Q);
-	addAction("gunAttack", sf::Keyboard::Enter);
-	addAction("meleeAttack", sf::Keyboard::BackSlash);
-	addAction("pauseScreen", sf::Keyboard::Escape);
+	addAction(ActionId::MovingUp, {sf::Keyboard::W, sf::Keyboard::Up});
+	addAction(ActionId::MovingDown, {sf::Keyboard::S, sf::Keyboard::Down});
+	addAction(ActionId::MovingRight, {sf::Keyboard::D, sf::Keyboard::Right});
+	addAction(ActionId::MovingLeft, {sf::Keyboard::A, sf::Keyboard::Left});
+	addAction(ActionId::Use, sf::Keyboard::E);
+	addAction(ActionId::ChangeWeapon, sf::Keyboard::Q);
+	addAction(ActionId::GunAttack, sf::Keyboard::Enter);
+	addAction(ActionId::MeleeAttack, sf::Keyboard::BackSlash);
+	addAction(ActionId::PauseScreen, sf::Keyboard::Escape);
 }
 
-void ActionEventManager::addAction(const std::string& action, std::vector<sf::Keyboard::Key> buttons)
+void ActionEventManager::addAction(ActionId action, std::vector<sf::Keyboard::Key> buttons)
 {
 	auto last = std::unique(buttons.begin(), buttons.end());
 	buttons.erase(last, buttons.end());
-	mActions[action] = Action{buttons, true};
+	getAction(action) = Action{buttons, true};
 	PH_LOG_INFO("Action was added to ActionEventManager.");
 }
 
-void ActionEventManager::addAction(const std::string& action, sf::Keyboard::Key button)
+void ActionEventManager::addAction(ActionId action, sf::Keyboard::Key button)
 {
-	mActions[action] = {std::vector<sf::Keyboard::Key>{button}, true};
+	getAction(action) = {std::vector<sf::Keyboard::Key>{button}, true};
 	PH_LOG_INFO("Action was added to ActionEventManager.");
 }
 
-void ActionEventManager::addKeyToAction(const std::string& action, sf::Keyboard::Key button)
+void ActionEventManager::addKeyToAction(ActionId action, sf::Keyboard::Key button)
 {
-	auto found = mActions.find(action);
-
-	if(found != mActions.end()) {
-		auto& vec = found->second.keys;
-		if(std::find(vec.begin(), vec.end(), button) == vec.end())
-			vec.emplace_back(button);
-	}
+	auto& vec = getAction(action).keys;
+	if(std::find(vec.begin(), vec.end(), button) == vec.end())
+		vec.emplace_back(button);
 	PH_LOG_INFO("Key was added to action.");
 }
 
-void ActionEventManager::deleteKeyFromAction(const std::string& action, sf::Keyboard::Key button)
+void ActionEventManager::deleteKeyFromAction(ActionId action, sf::Keyboard::Key button)
 {
-	auto found = mActions.find(action);
-
-	if(found != mActions.end()) {
-		auto& vec = found->second.keys;
-		vec.erase(std::remove(vec.begin(), vec.end(), button), vec.end());
-	}
+	auto& vec = getAction(action).keys;
+	vec.erase(std::remove(vec.begin(), vec.end(), button), vec.end());
 	PH_LOG_INFO("Key was deleted from action.");
 }
 
-void ActionEventManager::deleteAction(const std::string& action)
+void ActionEventManager::deleteAction(ActionId action)
 {
-	auto found = mActions.find(action);
-	mActions.erase(found);
+	getAction(action) = Action{};
 	PH_LOG_INFO("Action was deleted from ActionEventManager.");
 }
-void ActionEventManager::setActionEnabled(const std::string& action, bool enabled)
+void ActionEventManager::setActionEnabled(ActionId action, bool enabled)
 {
-	auto found = mActions.find(action);
-	if(found != mActions.end())
-		found->second.enabled = enabled;
+	getAction(action).enabled = enabled;
 }
 
 void ActionEventManager::setAllActionsEnabled(bool enabled)
 {
 	for(auto& action : mActions)
-		action.second.enabled = enabled;
+		action.enabled = enabled;
 }
 
 void ActionEventManager::clearAllActions() noexcept
 {
-	mActions.clear();
+	mActions.fill(Action{});
 	PH_LOG_INFO("All actions were cleared.");
 }
 
@@ -89,12 +78,12 @@ void ActionEventManager::setEnabled(bool enabled)
 	mEnabled = enabled;
 }
 
-bool ActionEventManager::isActionPressed(const std::string& action)
+bool ActionEventManager::isActionPressed(ActionId action)
 {
 	if(!mEnabled)
 		return false;
 
-	for(const auto& button : mActions[action].keys)
+	for(const auto& button : getAction(action).keys)
 		if(sf::Keyboard::isKeyPressed(button))
 			return true;
 	return false;
@@ -104,15 +93,15 @@ void ActionEventManager::addActionEventsTo(std::vector<ActionEvent>& actionEvent
 {
 	if(currentSfmlEvent.type == sf::Event::KeyPressed || currentSfmlEvent.type == sf::Event::KeyReleased)
 	{
-		for(const auto& action : mActions) 
+		for(size_t i = 0; i < nrOfActions; ++i) 
 		{
-			if(action.second.enabled) 
+			const auto& action = mActions[i];
+			if(action.enabled) 
 			{
-				auto actionKeys = action.second.keys;
-				auto found = std::find(actionKeys.begin(), actionKeys.end(), currentSfmlEvent.key.code);
-				if(found != actionKeys.end()) {
+				auto found = std::find(action.keys.begin(), action.keys.end(), currentSfmlEvent.key.code);
+				if(found != action.keys.end()) {
 					ActionEvent actionEvent(
-						action.first,
+						static_cast<ActionId>(i),
 						currentSfmlEvent.type == sf::Event::KeyPressed ? ActionEvent::Pressed : ActionEvent::Released
 					);
 					actionEvents.emplace_back(actionEvent);
@@ -122,4 +111,9 @@ void ActionEventManager::addActionEventsTo(std::vector<ActionEvent>& actionEvent
 	}
 }
 
+Action& ActionEventManager::getAction(ActionId action)
+{
+	return mActions[static_cast<size_t>(action)];
+}
+
 }
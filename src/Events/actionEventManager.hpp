@@ -2,16 +2,15 @@
 
 #include "actionEvent.hpp"
 #include <SFML/Window.hpp>
-#include <string>
 #include <vector>
-#include <map>
+#include <array>
 
 namespace ph {
 
 struct Action
 {
 	std::vector<sf::Keyboard::Key> keys;
-	bool enabled;
+	bool enabled = true;
 };
 
 class ActionEventManager
@@ -20,24 +19,28 @@ public:
 	// TODO: Init it somewhere else
 	static void init();
 
-	static void addAction(const std::string& action, std::vector<sf::Keyboard::Key>);
-	static void addAction(const std::string& action, sf::Keyboard::Key);
-	static void addKeyToAction(const std::string& action, sf::Keyboard::Key);
-	static void deleteKeyFromAction(const std::string& action, sf::Keyboard::Key);
-	static void deleteAction(const std::string& action);
-	static void setActionEnabled(const std::string& action, bool enabled);
+	static void addAction(ActionId action, std::vector<sf::Keyboard::Key>);
+	static void addAction(ActionId action, sf::Keyboard::Key);
+	static void addKeyToAction(ActionId action, sf::Keyboard::Key);
+	static void deleteKeyFromAction(ActionId action, sf::Keyboard::Key);
+	static void deleteAction(ActionId action);
+	static void setActionEnabled(ActionId action, bool enabled);
 	static void setAllActionsEnabled(bool enabled);
 	static void clearAllActions() noexcept;
 
 	static bool isEnabled() { return mEnabled; }
 	static void setEnabled(bool enabled);
 
-	static bool isActionPressed(const std::string& action);
+	static bool isActionPressed(ActionId action);
 
 	static void addActionEventsTo(std::vector<ActionEvent>&, const sf::Event currentSfmlEvent);
 
 private:
-	inline static std::map<std::string, Action> mActions;
+	static Action& getAction(ActionId);
+
+private:
+	// indexed by ActionId, action without keys is never pressed
+	inline static std::array<Action, nrOfActions> mActions;
 	inline static bool mEnabled;
 };
 
@@ -4,12 +4,17 @@
 
 namespace ph {
 
-void handleGlobalKeyboardShortcuts(sf::Window& window, GameCloser& gameCloser, const ph::Event& phEvent)
+void handleGlobalKeyboardShortcuts(sf::RenderWindow& window, GameCloser& gameCloser, const ph::Event& phEvent)
 {
 	if(auto* e = std::get_if<sf::Event>(&phEvent))
 	{
 		if(e->type == sf::Event::KeyPressed && e->key.code == sf::Keyboard::F11)
 		{
+			// window can't be recreated while render thread uses its GL context
+			const bool wasRenderThreadRunning = Renderer::isRenderThreadRunning();
+			if(wasRenderThreadRunning)
+				Renderer::stopRenderThread();
+
 			auto windowSize = window.getSize();
 			if(windowSize == sf::Vector2u(sf::VideoMode::getDesktopMode().width, sf::VideoMode::getDesktopMode().height)) {
 				window.create(sf::VideoMode(640, 360), "PopHead", sf::Style::Default, sf::ContextSettings(24, 8, 0, 3, 3));
@@ -21,6 +26,9 @@ void handleGlobalKeyboardShortcuts(sf::Window& window, GameCloser& gameCloser, c
 			}
 			window.setVerticalSyncEnabled(true);
 			window.setKeyRepeatEnabled(false);
+
+			if(wasRenderThreadRunning)
+				Renderer::startRenderThread(window);
 		}
 	}
 
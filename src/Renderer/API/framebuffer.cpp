@@ -5,8 +5,11 @@
 
 namespace ph {
 
-void Framebuffer::init(const unsigned width, const unsigned height)
+void Framebuffer::init(const unsigned width, const unsigned height, bool hasDepthStencilBuffer)
 {
+	mWidth = width;
+	mHeight = height;
+
 	GLCheck( glGenFramebuffers(1, &mFramebufferID) );
 	GLCheck( glBindFramebuffer(GL_FRAMEBUFFER, mFramebufferID) );
 
@@ -19,10 +22,13 @@ void Framebuffer::init(const unsigned width, const unsigned height)
 	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE) );
 	GLCheck( glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorBufferTextureID, 0) );
 
-	GLCheck( glGenRenderbuffers(1, &mRenderBufferID) );
-	GLCheck( glBindRenderbuffer(GL_RENDERBUFFER, mRenderBufferID) );
-	GLCheck( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height) );
-	GLCheck( glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mRenderBufferID) );
+	mRenderBufferID = 0;
+	if(hasDepthStencilBuffer) {
+		GLCheck( glGenRenderbuffers(1, &mRenderBufferID) );
+		GLCheck( glBindRenderbuffer(GL_RENDERBUFFER, mRenderBufferID) );
+		GLCheck( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height) );
+		GLCheck( glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mRenderBufferID) );
+	}
 
 	PH_ASSERT_UNEXPECTED_SITUATION(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is not complete!");
 	
@@ -33,16 +39,22 @@ void Framebuffer::remove()
 {
 	GLCheck( glDeleteFramebuffers(1, &mFramebufferID) );
 	GLCheck( glDeleteTextures(1, &mColorBufferTextureID) );
-	GLCheck( glDeleteRenderbuffers(1, &mRenderBufferID) );
+	if(mRenderBufferID)
+		GLCheck( glDeleteRenderbuffers(1, &mRenderBufferID) );
 }
 
 void Framebuffer::onWindowResize(const unsigned width, const unsigned height)
 {
+	mWidth = width;
+	mHeight = height;
+
 	GLCheck( glBindTexture(GL_TEXTURE_2D, mColorBufferTextureID) );
 	GLCheck( glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr) );
 
-	GLCheck( glBindRenderbuffer(GL_RENDERBUFFER, mRenderBufferID) );
-	GLCheck( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height) );
+	if(mRenderBufferID) {
+		GLCheck( glBindRenderbuffer(GL_RENDERBUFFER, mRenderBufferID) );
+		GLCheck( glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height) );
+	}
 	
 	PH_ASSERT_UNEXPECTED_SITUATION(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is not complete!");
 }
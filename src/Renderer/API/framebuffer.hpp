@@ -5,18 +5,23 @@ namespace ph {
 class Framebuffer
 {
 public:
-	void init(const unsigned width, const unsigned height);
+	void init(const unsigned width, const unsigned height, bool hasDepthStencilBuffer = true);
 	void remove();
 
 	void onWindowResize(const unsigned width, const unsigned height);
 
 	void bind();
 	void bindTextureColorBuffer(unsigned slot);
+
+	unsigned getWidth() const { return mWidth; }
+	unsigned getHeight() const { return mHeight; }
 	
 private:
 	unsigned mFramebufferID;
 	unsigned mColorBufferTextureID;
 	unsigned mRenderBufferID;
+	unsigned mWidth;
+	unsigned mHeight;
 };
 
 }
@@ -1,31 +1,31 @@
 #include "indexBuffer.hpp"
-#include "openglErrors.hpp"
+#include "renderingBackend.hpp"
 #include "Logs/logs.hpp"
-#include "GL/glew.h"
 #include <array>
 
 namespace ph {
 
 void IndexBuffer::init()
 {
-	GLCheck( glGenBuffers(1, &mID) );
+	mID = RenderingBackend::getCurrent().createBuffer();
 }
 
 void IndexBuffer::remove()
 {
-	GLCheck( glDeleteBuffers(1, &mID) );
+	RenderingBackend::getCurrent().deleteBuffer(mID);
 }
 
 void IndexBuffer::setData(unsigned* indices, unsigned numberOfIndices)
 {
-	GLCheck( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mID) );
-	GLCheck( glBufferData(GL_ELEMENT_ARRAY_BUFFER, numberOfIndices * sizeof(unsigned), indices, GL_STATIC_DRAW) );
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindBuffer(BufferType::Index, mID);
+	backend.setBufferData(BufferType::Index, numberOfIndices * sizeof(unsigned), indices, BufferUsage::Static);
 	mNumberOfIndices = numberOfIndices;
 }
 
 void IndexBuffer::bind()
 {
-	GLCheck( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mID) );
+	RenderingBackend::getCurrent().bindBuffer(BufferType::Index, mID);
 }
 
 }
@@ -0,0 +1,181 @@
+#include "nullRenderingBackend.hpp"
+
+namespace ph {
+
+unsigned NullRenderingBackend::createVertexArray()
+{
+	++mRecorded.calls;
+	return ++mLastObjectID;
+}
+
+void NullRenderingBackend::deleteVertexArray(unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::bindVertexArray(unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::setVertexAttribute(unsigned, int, size_t, size_t, unsigned)
+{
+	++mRecorded.calls;
+}
+
+unsigned NullRenderingBackend::createBuffer()
+{
+	++mRecorded.calls;
+	return ++mLastObjectID;
+}
+
+void NullRenderingBackend::deleteBuffer(unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::bindBuffer(BufferType, unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::setBufferData(BufferType, size_t size, const void*, BufferUsage)
+{
+	++mRecorded.calls;
+	++mRecorded.bufferUploads;
+	mRecorded.uploadedBytes += size;
+}
+
+void NullRenderingBackend::setBufferSubData(BufferType, size_t, size_t size, const void*)
+{
+	++mRecorded.calls;
+	++mRecorded.bufferUploads;
+	mRecorded.uploadedBytes += size;
+}
+
+unsigned NullRenderingBackend::createShaderProgram(const char*, const char*)
+{
+	++mRecorded.calls;
+	return ++mLastObjectID;
+}
+
+void NullRenderingBackend::useShaderProgram(unsigned)
+{
+	++mRecorded.calls;
+	++mRecorded.shaderBinds;
+}
+
+int NullRenderingBackend::getUniformLocation(unsigned, const char*)
+{
+	++mRecorded.calls;
+	return 0;
+}
+
+void NullRenderingBackend::bindUniformBlock(unsigned, const char*, unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::setUniformInt(int, int)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformUnsignedInt(int, unsigned)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformFloat(int, float)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformVector2(int, float, float)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformVector3(int, float, float, float)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformVector4(int, float, float, float, float)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformMatrix4x4(int, const float*)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformFloatArray(int, int, const float*)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+void NullRenderingBackend::setUniformIntArray(int, int, const int*)
+{
+	++mRecorded.calls;
+	++mRecorded.uniformUpdates;
+}
+
+unsigned NullRenderingBackend::createTexture()
+{
+	++mRecorded.calls;
+	return ++mLastObjectID;
+}
+
+void NullRenderingBackend::deleteTexture(unsigned)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::setTextureData(unsigned, sf::Vector2i size, int nrOfChannels, const void*, bool)
+{
+	++mRecorded.calls;
+	mRecorded.uploadedBytes += size.x * size.y * nrOfChannels;
+}
+
+void NullRenderingBackend::bindTexture(unsigned, unsigned)
+{
+	++mRecorded.calls;
+	++mRecorded.textureBinds;
+}
+
+void NullRenderingBackend::enable(Capability)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::setLineWidth(float)
+{
+	++mRecorded.calls;
+}
+
+void NullRenderingBackend::drawArrays(PrimitiveType, size_t, size_t nrOfVertices)
+{
+	++mRecorded.calls;
+	++mRecorded.drawCalls;
+	mRecorded.drawnVertices += nrOfVertices;
+}
+
+void NullRenderingBackend::drawIndexedInstanced(PrimitiveType, size_t nrOfIndices, size_t nrOfInstances)
+{
+	++mRecorded.calls;
+	++mRecorded.drawCalls;
+	mRecorded.drawnVertices += nrOfIndices * nrOfInstances;
+	mRecorded.drawnInstances += nrOfInstances;
+}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "renderingBackend.hpp"
+
+namespace ph {
+
+struct RecordedRenderingCalls
+{
+	size_t calls = 0;
+	size_t drawCalls = 0;
+	size_t drawnVertices = 0;
+	size_t drawnInstances = 0;
+	size_t bufferUploads = 0;
+	size_t uploadedBytes = 0;
+	size_t shaderBinds = 0;
+	size_t textureBinds = 0;
+	size_t uniformUpdates = 0;
+};
+
+// Backend which doesn't touch GPU at all, it only counts what would be sent to it.
+// It's used by unit tests and benchmarks which have no OpenGL context.
+
+class NullRenderingBackend : public RenderingBackend
+{
+public:
+	unsigned createVertexArray() override;
+	void deleteVertexArray(unsigned vertexArray) override;
+	void bindVertexArray(unsigned vertexArray) override;
+	void setVertexAttribute(unsigned index, int nrOfFloats, size_t stride, size_t offset, unsigned instanceDivisor) override;
+
+	unsigned createBuffer() override;
+	void deleteBuffer(unsigned buffer) override;
+	void bindBuffer(BufferType, unsigned buffer) override;
+	void setBufferData(BufferType, size_t size, const void* data, BufferUsage) override;
+	void setBufferSubData(BufferType, size_t offset, size_t size, const void* data) override;
+
+	unsigned createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) override;
+	void useShaderProgram(unsigned program) override;
+	int getUniformLocation(unsigned program, const char* name) override;
+	void bindUniformBlock(unsigned program, const char* blockName, unsigned bindingPoint) override;
+	void setUniformInt(int location, int value) override;
+	void setUniformUnsignedInt(int location, unsigned value) override;
+	void setUniformFloat(int location, float value) override;
+	void setUniformVector2(int location, float x, float y) override;
+	void setUniformVector3(int location, float x, float y, float z) override;
+	void setUniformVector4(int location, float x, float y, float z, float w) override;
+	void setUniformMatrix4x4(int location, const float* transform) override;
+	void setUniformFloatArray(int location, int count, const float* data) override;
+	void setUniformIntArray(int location, int count, const int* data) override;
+
+	unsigned createTexture() override;
+	void deleteTexture(unsigned texture) override;
+	void setTextureData(unsigned texture, sf::Vector2i size, int nrOfChannels, const void* data, bool generateMipmap) override;
+	void bindTexture(unsigned texture, unsigned slot) override;
+
+	void enable(Capability) override;
+	void setLineWidth(float width) override;
+	void drawArrays(PrimitiveType, size_t first, size_t nrOfVertices) override;
+	void drawIndexedInstanced(PrimitiveType, size_t nrOfIndices, size_t nrOfInstances) override;
+
+	const RecordedRenderingCalls& getRecordedCalls() const { return mRecorded; }
+	void clearRecordedCalls() { mRecorded = RecordedRenderingCalls(); }
+
+private:
+	RecordedRenderingCalls mRecorded;
+	unsigned mLastObjectID = 0;
+};
+
+}
@@ -0,0 +1,264 @@
+#include "openGLRenderingBackend.hpp"
+#include "openglErrors.hpp"
+#include "Logs/logs.hpp"
+#include <GL/glew.h>
+#include <string>
+#include <iostream>
+
+namespace ph {
+
+static OpenGLRenderingBackend openGLRenderingBackend;
+RenderingBackend* RenderingBackend::sCurrent = &openGLRenderingBackend;
+
+void RenderingBackend::setCurrent(RenderingBackend* backend)
+{
+	sCurrent = backend ? backend : &openGLRenderingBackend;
+}
+
+static GLenum toGLBufferTarget(BufferType type)
+{
+	return type == BufferType::Vertex ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+}
+
+static GLenum toGLPrimitive(PrimitiveType type)
+{
+	switch(type)
+	{
+		case PrimitiveType::Triangles: return GL_TRIANGLES;
+		case PrimitiveType::TriangleFan: return GL_TRIANGLE_FAN;
+		case PrimitiveType::Lines: return GL_LINES;
+		case PrimitiveType::Points: return GL_POINTS;
+	}
+	return GL_TRIANGLES;
+}
+
+unsigned OpenGLRenderingBackend::createVertexArray()
+{
+	unsigned vertexArray;
+	GLCheck( glGenVertexArrays(1, &vertexArray) );
+	return vertexArray;
+}
+
+void OpenGLRenderingBackend::deleteVertexArray(unsigned vertexArray)
+{
+	GLCheck( glDeleteVertexArrays(1, &vertexArray) );
+}
+
+void OpenGLRenderingBackend::bindVertexArray(unsigned vertexArray)
+{
+	GLCheck( glBindVertexArray(vertexArray) );
+}
+
+void OpenGLRenderingBackend::setVertexAttribute(unsigned index, int nrOfFloats, size_t stride, size_t offset, unsigned instanceDivisor)
+{
+	GLCheck( glEnableVertexAttribArray(index) );
+	GLCheck( glVertexAttribPointer(index, nrOfFloats, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*) offset) );
+	if(instanceDivisor) {
+		GLCheck( glVertexAttribDivisor(index, instanceDivisor) );
+	}
+}
+
+unsigned OpenGLRenderingBackend::createBuffer()
+{
+	unsigned buffer;
+	GLCheck( glGenBuffers(1, &buffer) );
+	return buffer;
+}
+
+void OpenGLRenderingBackend::deleteBuffer(unsigned buffer)
+{
+	GLCheck( glDeleteBuffers(1, &buffer) );
+}
+
+void OpenGLRenderingBackend::bindBuffer(BufferType type, unsigned buffer)
+{
+	GLCheck( glBindBuffer(toGLBufferTarget(type), buffer) );
+}
+
+void OpenGLRenderingBackend::setBufferData(BufferType type, size_t size, const void* data, BufferUsage usage)
+{
+	GLCheck( glBufferData(toGLBufferTarget(type), size, data, usage == BufferUsage::Static ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW) );
+}
+
+void OpenGLRenderingBackend::setBufferSubData(BufferType type, size_t offset, size_t size, const void* data)
+{
+	GLCheck( glBufferSubData(toGLBufferTarget(type), offset, size, data) );
+}
+
+unsigned OpenGLRenderingBackend::createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource)
+{
+	unsigned vertexShaderId = compileShader(vertexShaderSource, GL_VERTEX_SHADER);
+	unsigned fragmentShaderId = compileShader(fragmentShaderSource, GL_FRAGMENT_SHADER);
+
+	unsigned program = glCreateProgram();
+	GLCheck( glAttachShader(program, vertexShaderId) );
+	GLCheck( glAttachShader(program, fragmentShaderId) );
+	GLCheck( glLinkProgram(program) );
+
+	int success;
+	char infoLog[200];
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if(!success) {
+		glGetProgramInfoLog(program, sizeof(infoLog), NULL, infoLog);
+		PH_EXIT_GAME("Shader linking error:\n" + std::string(infoLog));
+	}
+	return program;
+}
+
+unsigned OpenGLRenderingBackend::compileShader(const char* sourceCode, unsigned shaderType)
+{
+	unsigned shaderId = glCreateShader(shaderType);
+	GLCheck( glShaderSource(shaderId, 1, &sourceCode, nullptr) );
+	GLCheck( glCompileShader(shaderId) );
+
+	int success;
+	char infoLog[200];
+	glGetShaderiv(shaderId, GL_COMPILE_STATUS, &success);
+	if(!success) {
+		glGetShaderInfoLog(shaderId, sizeof(infoLog), NULL, infoLog);
+		std::string type = shaderType == GL_VERTEX_SHADER ? "Vertex" : "Fragment";
+		std::cout << type + " shader compilation failed:\n" + infoLog << std::endl;
+		PH_EXIT_GAME(type + " shader compilation failed:\n" + infoLog);
+	}
+	return shaderId;
+}
+
+void OpenGLRenderingBackend::useShaderProgram(unsigned program)
+{
+	GLCheck( glUseProgram(program) );
+}
+
+int OpenGLRenderingBackend::getUniformLocation(unsigned program, const char* name)
+{
+	GLCheck( int location = glGetUniformLocation(program, name) );
+	return location;
+}
+
+void OpenGLRenderingBackend::bindUniformBlock(unsigned program, const char* blockName, unsigned bindingPoint)
+{
+	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(program, blockName) );
+	GLCheck( glUniformBlockBinding(program, uniformBlockIndex, bindingPoint) );
+}
+
+void OpenGLRenderingBackend::setUniformInt(int location, int value)
+{
+	GLCheck( glUniform1i(location, value) );
+}
+
+void OpenGLRenderingBackend::setUniformUnsignedInt(int location, unsigned value)
+{
+	GLCheck( glUniform1ui(location, value) );
+}
+
+void OpenGLRenderingBackend::setUniformFloat(int location, float value)
+{
+	GLCheck( glUniform1f(location, value) );
+}
+
+void OpenGLRenderingBackend::setUniformVector2(int location, float x, float y)
+{
+	GLCheck( glUniform2f(location, x, y) );
+}
+
+void OpenGLRenderingBackend::setUniformVector3(int location, float x, float y, float z)
+{
+	GLCheck( glUniform3f(location, x, y, z) );
+}
+
+void OpenGLRenderingBackend::setUniformVector4(int location, float x, float y, float z, float w)
+{
+	GLCheck( glUniform4f(location, x, y, z, w) );
+}
+
+void OpenGLRenderingBackend::setUniformMatrix4x4(int location, const float* transform)
+{
+	GLCheck( glUniformMatrix4fv(location, 1, GL_FALSE, transform) );
+}
+
+void OpenGLRenderingBackend::setUniformFloatArray(int location, int count, const float* data)
+{
+	GLCheck( glUniform1fv(location, count, data) );
+}
+
+void OpenGLRenderingBackend::setUniformIntArray(int location, int count, const int* data)
+{
+	GLCheck( glUniform1iv(location, count, data) );
+}
+
+unsigned OpenGLRenderingBackend::createTexture()
+{
+	unsigned texture;
+	GLCheck( glGenTextures(1, &texture) );
+	GLCheck( glBindTexture(GL_TEXTURE_2D, texture) );
+
+	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT) );
+	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT) );
+	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR) );
+	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR) );
+	return texture;
+}
+
+void OpenGLRenderingBackend::deleteTexture(unsigned texture)
+{
+	GLCheck( glDeleteTextures(1, &texture) );
+}
+
+void OpenGLRenderingBackend::setTextureData(unsigned texture, sf::Vector2i size, int nrOfChannels, const void* data, bool generateMipmap)
+{
+	GLCheck( glBindTexture(GL_TEXTURE_2D, texture) );
+
+	GLenum dataFormat = 0, internalDataFormat = 0;
+	if(nrOfChannels == 3) {
+		internalDataFormat = GL_RGB8;
+		dataFormat = GL_RGB;
+		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+	}
+	else {
+		internalDataFormat = GL_RGBA8;
+		dataFormat = GL_RGBA;
+		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 4) );
+	}
+
+	GLCheck( glTexImage2D(GL_TEXTURE_2D, 0, internalDataFormat, size.x, size.y, 0, dataFormat, GL_UNSIGNED_BYTE, data) );
+	if(generateMipmap) {
+		GLCheck( glGenerateMipmap(GL_TEXTURE_2D) );
+	}
+}
+
+void OpenGLRenderingBackend::bindTexture(unsigned texture, unsigned slot)
+{
+	GLCheck( glActiveTexture(GL_TEXTURE0 + slot) );
+	GLCheck( glBindTexture(GL_TEXTURE_2D, texture) );
+}
+
+void OpenGLRenderingBackend::enable(Capability capability)
+{
+	switch(capability)
+	{
+		case Capability::LineSmooth:
+			GLCheck( glEnable(GL_LINE_SMOOTH) );
+			GLCheck( glHint(GL_LINE_SMOOTH_HINT, GL_NICEST) );
+			break;
+		case Capability::ProgramPointSize:
+			GLCheck( glEnable(GL_PROGRAM_POINT_SIZE) );
+			break;
+	}
+}
+
+void OpenGLRenderingBackend::setLineWidth(float width)
+{
+	GLCheck( glLineWidth(width) );
+}
+
+void OpenGLRenderingBackend::drawArrays(PrimitiveType type, size_t first, size_t nrOfVertices)
+{
+	GLCheck( glDrawArrays(toGLPrimitive(type), static_cast<GLint>(first), static_cast<GLsizei>(nrOfVertices)) );
+}
+
+void OpenGLRenderingBackend::drawIndexedInstanced(PrimitiveType type, size_t nrOfIndices, size_t nrOfInstances)
+{
+	GLCheck( glDrawElementsInstanced(toGLPrimitive(type), static_cast<GLsizei>(nrOfIndices), GL_UNSIGNED_INT, 0,
+	                                 static_cast<GLsizei>(nrOfInstances)) );
+}
+
+}
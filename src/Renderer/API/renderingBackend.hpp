@@ -0,0 +1,65 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+
+namespace ph {
+
+enum class BufferType { Vertex, Index };
+enum class BufferUsage { Static, Dynamic };
+enum class PrimitiveType { Triangles, TriangleFan, Lines, Points };
+enum class Capability { LineSmooth, ProgramPointSize };
+
+// Minor renderers, shaders, textures and index buffers talk to the GPU only through this interface.
+// Thanks to that their cpu side work can be measured and tested without OpenGL context,
+// just set NullRenderingBackend as current backend before creating any of these objects.
+
+class RenderingBackend
+{
+public:
+	virtual ~RenderingBackend() = default;
+
+	virtual unsigned createVertexArray() = 0;
+	virtual void deleteVertexArray(unsigned vertexArray) = 0;
+	virtual void bindVertexArray(unsigned vertexArray) = 0;
+	virtual void setVertexAttribute(unsigned index, int nrOfFloats, size_t stride, size_t offset, unsigned instanceDivisor) = 0;
+
+	virtual unsigned createBuffer() = 0;
+	virtual void deleteBuffer(unsigned buffer) = 0;
+	virtual void bindBuffer(BufferType, unsigned buffer) = 0;
+	virtual void setBufferData(BufferType, size_t size, const void* data, BufferUsage) = 0;
+	virtual void setBufferSubData(BufferType, size_t offset, size_t size, const void* data) = 0;
+
+	virtual unsigned createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) = 0;
+	virtual void useShaderProgram(unsigned program) = 0;
+	virtual int getUniformLocation(unsigned program, const char* name) = 0;
+	virtual void bindUniformBlock(unsigned program, const char* blockName, unsigned bindingPoint) = 0;
+	virtual void setUniformInt(int location, int value) = 0;
+	virtual void setUniformUnsignedInt(int location, unsigned value) = 0;
+	virtual void setUniformFloat(int location, float value) = 0;
+	virtual void setUniformVector2(int location, float x, float y) = 0;
+	virtual void setUniformVector3(int location, float x, float y, float z) = 0;
+	virtual void setUniformVector4(int location, float x, float y, float z, float w) = 0;
+	virtual void setUniformMatrix4x4(int location, const float* transform) = 0;
+	virtual void setUniformFloatArray(int location, int count, const float* data) = 0;
+	virtual void setUniformIntArray(int location, int count, const int* data) = 0;
+
+	virtual unsigned createTexture() = 0;
+	virtual void deleteTexture(unsigned texture) = 0;
+	virtual void setTextureData(unsigned texture, sf::Vector2i size, int nrOfChannels, const void* data, bool generateMipmap) = 0;
+	virtual void bindTexture(unsigned texture, unsigned slot) = 0;
+
+	virtual void enable(Capability) = 0;
+	virtual void setLineWidth(float width) = 0;
+	virtual void drawArrays(PrimitiveType, size_t first, size_t nrOfVertices) = 0;
+	virtual void drawIndexedInstanced(PrimitiveType, size_t nrOfIndices, size_t nrOfInstances) = 0;
+
+	// objects have to be destroyed with the same backend which was current when they were created
+	static RenderingBackend& getCurrent() { return *sCurrent; }
+	static void setCurrent(RenderingBackend* backend);
+
+private:
+	static RenderingBackend* sCurrent;
+};
+
+}
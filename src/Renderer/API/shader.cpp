@@ -1,17 +1,15 @@
 #include "shader.hpp"
-#include "openglErrors.hpp"
+#include "renderingBackend.hpp"
 #include "Logs/logs.hpp"
-#include <GL/glew.h>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
-#include <iostream>
 
 namespace ph {
 
 Shader::Shader()
+	:mID(0)
 {
-	mID = glCreateProgram();
 }
 
 bool Shader::loadFromFile(const char* vertexShaderFilename, const char* fragmentShaderFilename)
@@ -47,113 +45,70 @@ auto Shader::getShaderCodeFromFile(const char* filename) -> const std::optional<
 
 void Shader::loadFromString(const char* vertexShaderSource, const char* fragmentShaderSource)
 {
-	int vertexShaderId = compileShaderAndGetId(vertexShaderSource, GL_VERTEX_SHADER);
-	int fragmentShaderId = compileShaderAndGetId(fragmentShaderSource, GL_FRAGMENT_SHADER);
-	linkProgram(vertexShaderId, fragmentShaderId);
-}
-
-int Shader::compileShaderAndGetId(const char* sourceCode, const unsigned shaderType)
-{
-	unsigned shaderId = glCreateShader(shaderType);
-	GLCheck( glShaderSource(shaderId, 1, &sourceCode, nullptr) );
-	GLCheck( glCompileShader(shaderId) );
-	checkCompilationErrors(shaderId, shaderType);
-	return shaderId;
-}
-
-void Shader::checkCompilationErrors(const unsigned shaderId, const unsigned shaderType)
-{
-	int success;
-	char infoLog[200];
-	glGetShaderiv(shaderId, GL_COMPILE_STATUS, &success);
-	if(!success) {
-		glGetShaderInfoLog(shaderId, sizeof(infoLog), NULL, infoLog);
-		std::string type = shaderType == GL_VERTEX_SHADER ? "Vertex" : "Fragment";
-		std::cout << type + " shader compilation failed:\n" + infoLog << std::endl;
-		PH_EXIT_GAME(type + " shader compilation failed:\n" + infoLog);
-	}
-}
-
-void Shader::linkProgram(const int vertexShaderId, const int fragmentShaderId)
-{
-	GLCheck( glAttachShader(mID, vertexShaderId) );
-	GLCheck( glAttachShader(mID, fragmentShaderId) );
-	GLCheck( glLinkProgram(mID) );
-	checkLinkingErrors();
-}
-
-void Shader::checkLinkingErrors()
-{
-	int success;
-	char infoLog[200];
-	glGetProgramiv(mID, GL_LINK_STATUS, &success);
-	if(!success) {
-		glGetProgramInfoLog(mID, sizeof(infoLog), NULL, infoLog);
-		PH_EXIT_GAME("Shader linking error:\n" + std::string(infoLog));
-	}
+	mID = RenderingBackend::getCurrent().createShaderProgram(vertexShaderSource, fragmentShaderSource);
 }
 
 void Shader::bind() const
 {
-	GLCheck( glUseProgram(mID) );
+	RenderingBackend::getCurrent().useShaderProgram(mID);
 }
 
 void Shader::unbind() const
 {
-	GLCheck( glUseProgram(0) );
+	RenderingBackend::getCurrent().useShaderProgram(0);
 }
 
 void Shader::setUniformBool(const char* name, const bool value) const
 {
-	GLCheck( glUniform1i(getUniformLocation(name), static_cast<int>(value)) );
+	RenderingBackend::getCurrent().setUniformInt(getUniformLocation(name), static_cast<int>(value));
 }
 
 void Shader::setUniformInt(const char* name, const int value) const
 {
-	GLCheck( glUniform1i(getUniformLocation(name), value) );
+	RenderingBackend::getCurrent().setUniformInt(getUniformLocation(name), value);
 }
 
 void Shader::setUniformUnsignedInt(const char* name, const unsigned value) const
 {
-	GLCheck( glUniform1ui(getUniformLocation(name), value) );
+	RenderingBackend::getCurrent().setUniformUnsignedInt(getUniformLocation(name), value);
 }
 
 void Shader::setUniformFloat(const char* name, const float value) const
 {
-	GLCheck( glUniform1f(getUniformLocation(name), value) );
+	RenderingBackend::getCurrent().setUniformFloat(getUniformLocation(name), value);
 }
 
 void Shader::setUniformVector2(const char* name, const sf::Vector2f value) const
 {
-	GLCheck( glUniform2f(getUniformLocation(name), value.x, value.y) );
+	RenderingBackend::getCurrent().setUniformVector2(getUniformLocation(name), value.x, value.y);
 }
 
 void Shader::setUniformVector2(const char* name, const float x, const float y) const
 {
-	GLCheck( glUniform2f(getUniformLocation(name), x, y) );
+	RenderingBackend::getCurrent().setUniformVector2(getUniformLocation(name), x, y);
 }
 
 void Shader::setUniformVector3(const char* name, const sf::Vector3f value) const
 {
-	GLCheck( glUniform3f(getUniformLocation(name), value.x, value.y, value.z) );
+	RenderingBackend::getCurrent().setUniformVector3(getUniformLocation(name), value.x, value.y, value.z);
 }
 
 void Shader::setUniformVector3(const char* name, const float x, const float y, const float z) const
 {
-	GLCheck( glUniform3f(getUniformLocation(name), x, y, z) );
+	RenderingBackend::getCurrent().setUniformVector3(getUniformLocation(name), x, y, z);
 }
 
 void Shader::setUniformVector4Color(const char* name, const sf::Color& color) const
 {
-	GLCheck( glUniform4f(getUniformLocation(name),
+	RenderingBackend::getCurrent().setUniformVector4(getUniformLocation(name),
 		static_cast<float>(color.r) / 255.f, static_cast<float>(color.g) / 255.f,
 		static_cast<float>(color.b) / 255.f, static_cast<float>(color.a) / 255.f
-	) );
+	);
 }
 
 void Shader::setUniformVector4(const char* name, const float x, const float y, const float z, const float w) const
 {
-	GLCheck( glUniform4f(getUniformLocation(name), x, y, z, w) );
+	RenderingBackend::getCurrent().setUniformVector4(getUniformLocation(name), x, y, z, w);
 }
 
 void Shader::setUniformVector4Rect(const char* name, const FloatRect& r) const
@@ -163,17 +118,17 @@ void Shader::setUniformVector4Rect(const char* name, const FloatRect& r) const
 
 void Shader::setUniformMatrix4x4(const char* name, const float* transform) const
 {
-	GLCheck( glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, transform) );
+	RenderingBackend::getCurrent().setUniformMatrix4x4(getUniformLocation(name), transform);
 }
 
 void Shader::setUniformFloatArray(const char* name, int count, const float* data) const
 {
-	GLCheck( glUniform1fv(getUniformLocation(name), count, data) );
+	RenderingBackend::getCurrent().setUniformFloatArray(getUniformLocation(name), count, data);
 }
 
 void Shader::setUniformIntArray(const char* name, int count, const int* data) const
 {
-	GLCheck( glUniform1iv(getUniformLocation(name), count, data) );
+	RenderingBackend::getCurrent().setUniformIntArray(getUniformLocation(name), count, data);
 }
 
 int Shader::getUniformLocation(const char* name) const
@@ -181,7 +136,7 @@ int Shader::getUniformLocation(const char* name) const
 	if(mUniformsLocationCache.find(name) != mUniformsLocationCache.end())
 		return mUniformsLocationCache[name];
 
-	GLCheck( int location = glGetUniformLocation(mID, name) );
+	int location = RenderingBackend::getCurrent().getUniformLocation(mID, name);
 	mUniformsLocationCache[name] = location;
 	return location;
 }
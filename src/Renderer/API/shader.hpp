@@ -41,10 +41,6 @@ public:
 
 private:
 	auto getShaderCodeFromFile(const char* filename) -> const std::optional<std::string>;
-	int compileShaderAndGetId(const char* sourceCode, const unsigned shaderType);
-	void checkCompilationErrors(const unsigned shaderId, const unsigned shaderType);
-	void linkProgram(const int vertexShaderId, const int fragmentShaderId);
-	void checkLinkingErrors();
 
 	int getUniformLocation(const char* name) const;
 
@@ -1,8 +1,7 @@
 #include "texture.hpp"
-#include "openglErrors.hpp"
+#include "renderingBackend.hpp"
 #include "Logs/logs.hpp"
 #include <stdexcept>
-#include <GL/glew.h>
 
 //#define STB_IMAGE_IMPLEMENTATION - uncomment if we don't link to sfml-graphics module
 #include <stb_image.h>
@@ -10,14 +9,8 @@
 namespace ph {
 
 Texture::Texture()
+	:mID(RenderingBackend::getCurrent().createTexture())
 {
-	GLCheck( glGenTextures(1, &mID) );
-	GLCheck( glBindTexture(GL_TEXTURE_2D, mID) );
-
-	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT) );
-	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT) );
-	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR) );
-	GLCheck( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR) );
 }
 
 Texture::Texture(const std::string& filepath)
@@ -28,7 +21,7 @@ Texture::Texture(const std::string& filepath)
 
 Texture::~Texture()
 {
-	GLCheck( glDeleteTextures(1, &mID) );
+	RenderingBackend::getCurrent().deleteTexture(mID);
 }
 
 bool Texture::loadFromFile(const std::string& filepath)
@@ -41,22 +34,10 @@ bool Texture::loadFromFile(const std::string& filepath)
 	if(data == nullptr)
 		return false;
 
-	GLenum dataFormat = 0, internalDataFormat = 0;
-	if(numberOfChanels == 3) {
-		internalDataFormat = GL_RGB8;
-		dataFormat = GL_RGB;
-		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
-	}
-	else if(numberOfChanels == 4) {
-		internalDataFormat = GL_RGBA8;
-		dataFormat = GL_RGBA;
-		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 4) );
-	}
-	else
+	if(numberOfChanels != 3 && numberOfChanels != 4)
 		PH_EXIT_GAME("Texture format of \"" + filepath + "\" is unsupported!");
 
-	GLCheck( glTexImage2D(GL_TEXTURE_2D, 0, internalDataFormat, mSize.x, mSize.y, 0, dataFormat, GL_UNSIGNED_BYTE, data) );
-	GLCheck( glGenerateMipmap(GL_TEXTURE_2D) );
+	RenderingBackend::getCurrent().setTextureData(mID, mSize, numberOfChanels, data, true);
 
 	stbi_image_free(data);
 
@@ -68,13 +49,13 @@ void Texture::setData(void* rgbaData, unsigned arraySize, sf::Vector2i textureSi
 	// TODO_ren: Make possible setting data for different formats rgb, rgba (now it's only rgba)
 	
 	PH_ASSERT_CRITICAL(arraySize == 4 * textureSize.x * textureSize.y, "Data must be for entire texture!");
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, textureSize.x, textureSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
+	mSize = textureSize;
+	RenderingBackend::getCurrent().setTextureData(mID, textureSize, 4, rgbaData, false);
 }
 
 void Texture::bind(unsigned slot) const
 {
-	GLCheck( glActiveTexture(GL_TEXTURE0 + slot) );
-	GLCheck( glBindTexture(GL_TEXTURE_2D, mID) );
+	RenderingBackend::getCurrent().bindTexture(mID, slot);
 }
 
 }
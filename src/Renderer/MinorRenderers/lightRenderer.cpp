@@ -1,13 +1,13 @@
 #include "lightRenderer.hpp"
 #include "Renderer/renderer.hpp"
 #include "Renderer/API/shader.hpp"
+#include "Renderer/API/renderingBackend.hpp"
 #include "Utilities/math.hpp"
 #include "Utilities/profiling.hpp"
 #include "Logs/logs.hpp"
 #include <optional>
 #include <cmath>
 #include <algorithm>
-#include <GL/glew.h>
 
 namespace ph {
 
@@ -17,25 +17,24 @@ void LightRenderer::init()
 	sl.loadFromFile("light", "resources/shaders/light.vs.glsl", "resources/shaders/light.fs.glsl");
 	mLightShader = sl.get("light");
 
-	unsigned uniformBlockIndex = glGetUniformBlockIndex(mLightShader->getID(), "SharedData");
-	glUniformBlockBinding(mLightShader->getID(), uniformBlockIndex, 0);
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindUniformBlock(mLightShader->getID(), "SharedData", 0);
 	
-	glGenVertexArrays(1, &mVAO);
-	glBindVertexArray(mVAO);
+	mVAO = backend.createVertexArray();
+	backend.bindVertexArray(mVAO);
 
-	glGenBuffers(1, &mVBO);
-	glBindBuffer(GL_ARRAY_BUFFER, mVBO);
+	mVBO = backend.createBuffer();
+	backend.bindBuffer(BufferType::Vertex, mVBO);
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), ( void*) 0);
+	backend.setVertexAttribute(0, 2, 2 * sizeof(float), 0, 0);
 
 	mLightPolygonVertexData.reserve(361);
 }
 
 void LightRenderer::shutDown()
 {
-	glDeleteBuffers(1, &mVBO);
-	glDeleteVertexArrays(1, &mVAO);
+	RenderingBackend::getCurrent().deleteBuffer(mVBO);
+	RenderingBackend::getCurrent().deleteVertexArray(mVAO);
 }
 
 void LightRenderer::submitLightBlockingQuad(sf::Vector2f position, sf::Vector2f size)
@@ -113,10 +112,12 @@ void LightRenderer::flush()
 			mLightShader->setUniformFloat("a", light.attenuationAddition);
 			mLightShader->setUniformFloat("b", light.attenuationFactor);
 			mLightShader->setUniformFloat("c", light.attenuationSquareFactor);
-			glBindVertexArray(mVAO);
-			glBindBuffer(GL_ARRAY_BUFFER ,mVBO); // TODO: Do I have to bind it?
-			glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 2 * mLightPolygonVertexData.size(), mLightPolygonVertexData.data(), GL_STATIC_DRAW);
-			glDrawArrays(GL_TRIANGLE_FAN, 0, mLightPolygonVertexData.size());
+			auto& backend = RenderingBackend::getCurrent();
+			backend.bindVertexArray(mVAO);
+			backend.bindBuffer(BufferType::Vertex, mVBO); // TODO: Do I have to bind it?
+			backend.setBufferData(BufferType::Vertex, sizeof(float) * 2 * mLightPolygonVertexData.size(),
+			                      mLightPolygonVertexData.data(), BufferUsage::Static);
+			backend.drawArrays(PrimitiveType::TriangleFan, 0, mLightPolygonVertexData.size());
 		}
 
 		// draw debug 
@@ -1,10 +1,9 @@
 #include "lineRenderer.hpp"
 #include "Renderer/API/shader.hpp"
-#include "Renderer/API/openglErrors.hpp"
+#include "Renderer/API/renderingBackend.hpp"
 #include "Utilities/profiling.hpp"
 #include "Utilities/vector4.hpp"
 #include "Utilities/cast.hpp"
-#include <GL/glew.h>
 
 namespace ph {
 
@@ -14,29 +13,26 @@ void LineRenderer::init()
 	sl.loadFromFile("line", "resources/shaders/line.vs.glsl", "resources/shaders/line.fs.glsl");
 	mLineShader = sl.get("line");
 
-	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(mLineShader->getID(), "SharedData") );
-	GLCheck( glUniformBlockBinding(mLineShader->getID(), uniformBlockIndex, 0) );
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindUniformBlock(mLineShader->getID(), "SharedData", 0);
 
-	GLCheck( glEnable(GL_LINE_SMOOTH) );
-	GLCheck( glHint(GL_LINE_SMOOTH_HINT, GL_NICEST) );
+	backend.enable(Capability::LineSmooth);
 
-	GLCheck( glGenVertexArrays(1, &mLineVAO) );
-	GLCheck( glBindVertexArray(mLineVAO) );
+	mLineVAO = backend.createVertexArray();
+	backend.bindVertexArray(mLineVAO);
 
-	GLCheck( glGenBuffers(1, &mLineVBO) );
-	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mLineVBO) );
-	GLCheck( glBufferData(GL_ARRAY_BUFFER, 2 * 6 * sizeof(float), nullptr, GL_DYNAMIC_DRAW) );
+	mLineVBO = backend.createBuffer();
+	backend.bindBuffer(BufferType::Vertex, mLineVBO);
+	backend.setBufferData(BufferType::Vertex, 2 * 6 * sizeof(float), nullptr, BufferUsage::Dynamic);
 
-	GLCheck( glEnableVertexAttribArray(0) );
-	GLCheck( glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0) );
-	GLCheck( glEnableVertexAttribArray(1) );
-	GLCheck( glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(2 * sizeof(float))) );
+	backend.setVertexAttribute(0, 2, 6 * sizeof(float), 0, 0);
+	backend.setVertexAttribute(1, 4, 6 * sizeof(float), 2 * sizeof(float), 0);
 }
 
 void LineRenderer::shutDown()
 {
-	GLCheck( glDeleteVertexArrays(1, &mLineVAO) );
-	GLCheck( glDeleteBuffers(1, &mLineVBO) );
+	RenderingBackend::getCurrent().deleteVertexArray(mLineVAO);
+	RenderingBackend::getCurrent().deleteBuffer(mLineVBO);
 }
 
 void LineRenderer::setDebugNumbersToZero()
@@ -53,15 +49,16 @@ void LineRenderer::drawLine(const sf::Color& colorA, const sf::Color& colorB,
 		posA.x, posA.y, colA.x, colA.y, colA.z, colA.w,
 		posB.x, posB.y, colB.x, colB.y, colB.z, colB.w
 	};
-	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mLineVBO) );
-	GLCheck( glBufferSubData(GL_ARRAY_BUFFER, 0, 2 * 6 * sizeof(float), vertexData) );
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindBuffer(BufferType::Vertex, mLineVBO);
+	backend.setBufferSubData(BufferType::Vertex, 0, 2 * 6 * sizeof(float), vertexData);
 
-	GLCheck( glBindVertexArray(mLineVAO) );
+	backend.bindVertexArray(mLineVAO);
 	mLineShader->bind();
 	
-	GLCheck( glLineWidth(thickness * (360.f / mScreenBounds->height)) );
+	backend.setLineWidth(thickness * (360.f / mScreenBounds->height));
 
-	GLCheck( glDrawArrays(GL_LINES, 0, 2) );
+	backend.drawArrays(PrimitiveType::Lines, 0, 2);
 	++mNumberOfDrawCalls;
 }
 
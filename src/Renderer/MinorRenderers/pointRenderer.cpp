@@ -1,8 +1,7 @@
 #include "pointRenderer.hpp"
 #include "Utilities/cast.hpp"
 #include "Renderer/API/shader.hpp"
-#include "Renderer/API/openglErrors.hpp"
-#include <GL/glew.h>
+#include "Renderer/API/renderingBackend.hpp"
 
 namespace ph {
 
@@ -12,33 +11,29 @@ void PointRenderer::init()
 	sl.loadFromFile("points", "resources/shaders/points.vs.glsl", "resources/shaders/points.fs.glsl");
 	mPointsShader = sl.get("points");
 
-	glEnable(GL_PROGRAM_POINT_SIZE);
+	auto& backend = RenderingBackend::getCurrent();
+	backend.enable(Capability::ProgramPointSize);
 
-	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(mPointsShader->getID(), "SharedData") );
-	GLCheck( glUniformBlockBinding(mPointsShader->getID(), uniformBlockIndex, 0) );
+	backend.bindUniformBlock(mPointsShader->getID(), "SharedData", 0);
 
-	glGenVertexArrays(1, &mVAO);
-	glBindVertexArray(mVAO);
+	mVAO = backend.createVertexArray();
+	backend.bindVertexArray(mVAO);
 
-	glGenBuffers(1, &mVBO);
-	glBindBuffer(GL_ARRAY_BUFFER, mVBO);
+	mVBO = backend.createBuffer();
+	backend.bindBuffer(BufferType::Vertex, mVBO);
 
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	glEnableVertexAttribArray(3);
-	glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(PointVertexData), (void*)offsetof(PointVertexData, color));
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(PointVertexData), (void*)offsetof(PointVertexData, position));
-	glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(PointVertexData), (void*)offsetof(PointVertexData, size));
-	glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(PointVertexData), (void*)offsetof(PointVertexData, z));
+	backend.setVertexAttribute(0, 4, sizeof(PointVertexData), offsetof(PointVertexData, color), 0);
+	backend.setVertexAttribute(1, 2, sizeof(PointVertexData), offsetof(PointVertexData, position), 0);
+	backend.setVertexAttribute(2, 1, sizeof(PointVertexData), offsetof(PointVertexData, size), 0);
+	backend.setVertexAttribute(3, 1, sizeof(PointVertexData), offsetof(PointVertexData, z), 0);
 
 	mSubmitedPointsVertexData.reserve(100);
 }
 
 void PointRenderer::shutDown()
 {
-	glDeleteBuffers(1, &mVBO);
-	glDeleteVertexArrays(1, &mVAO);
+	RenderingBackend::getCurrent().deleteBuffer(mVBO);
+	RenderingBackend::getCurrent().deleteVertexArray(mVAO);
 }
 
 void PointRenderer::setDebugNumbersToZero()
@@ -66,13 +61,15 @@ void PointRenderer::flush()
 	if(mSubmitedPointsVertexData.empty())
 		return;
 
+	auto& backend = RenderingBackend::getCurrent();
 	mPointsShader->bind();
-	glBindVertexArray(mVAO);
+	backend.bindVertexArray(mVAO);
 
-	glBindBuffer(GL_ARRAY_BUFFER, mVBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(PointVertexData) * mSubmitedPointsVertexData.size(), mSubmitedPointsVertexData.data(), GL_STATIC_DRAW);
+	backend.bindBuffer(BufferType::Vertex, mVBO);
+	backend.setBufferData(BufferType::Vertex, sizeof(PointVertexData) * mSubmitedPointsVertexData.size(),
+	                      mSubmitedPointsVertexData.data(), BufferUsage::Static);
 
-	glDrawArrays(GL_POINTS, 0, mSubmitedPointsVertexData.size());
+	backend.drawArrays(PrimitiveType::Points, 0, mSubmitedPointsVertexData.size());
 
 	mSubmitedPointsVertexData.clear();
 	++mNrOfDrawCalls;
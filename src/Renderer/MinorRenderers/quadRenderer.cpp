@@ -1,11 +1,10 @@
 #include "quadRenderer.hpp"
 #include "Renderer/API/texture.hpp"
 #include "Renderer/API/shader.hpp"
-#include "Renderer/API/openglErrors.hpp"
+#include "Renderer/API/renderingBackend.hpp"
 #include "Utilities/cast.hpp"
 #include "Utilities/profiling.hpp"
 #include "Utilities/math.hpp"
-#include <GL/glew.h>
 #include <algorithm>
 
 namespace ph {
@@ -74,35 +73,28 @@ void QuadRenderer::init()
 	sl.loadFromFile("instancedSprite", "resources/shaders/instancedSprite.vs.glsl", "resources/shaders/instancedSprite.fs.glsl");
 	mDefaultInstanedSpriteShader = sl.get("instancedSprite");
 
-	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(mDefaultInstanedSpriteShader->getID(), "SharedData") );
-	GLCheck( glUniformBlockBinding(mDefaultInstanedSpriteShader->getID(), uniformBlockIndex, 0) );
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindUniformBlock(mDefaultInstanedSpriteShader->getID(), "SharedData", 0);
 
 	unsigned quadIndices[] = {0, 1, 3, 1, 2, 3};
 	mQuadIBO.init();
-	mQuadIBO.setData(quadIndices, sizeof(quadIndices));
+	mQuadIBO.setData(quadIndices, 6);
 
-	GLCheck( glGenVertexArrays(1, &mVAO) );
-	GLCheck( glBindVertexArray(mVAO) );
+	mVAO = backend.createVertexArray();
+	backend.bindVertexArray(mVAO);
 
 	mQuadIBO.bind();
 
-	GLCheck( glGenBuffers(1, &mQuadsDataVBO) );
-	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
+	mQuadsDataVBO = backend.createBuffer();
+	backend.bindBuffer(BufferType::Vertex, mQuadsDataVBO);
 
-	GLCheck( glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, color)) );
-	GLCheck( glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, textureRect)) );
-	GLCheck( glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, position)) );
-	GLCheck( glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, size)) );
-	GLCheck( glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, rotationOrigin)) );
-	GLCheck( glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, rotation)) );
-	GLCheck( glVertexAttribPointer(6, 1, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, textureSlotRef)) );
-
-	for(int i = 0; i < 7; ++i) {
-		GLCheck( glEnableVertexAttribArray(i) );
-	}
-	for(int i = 0; i < 7; ++i) {
-		GLCheck( glVertexAttribDivisor(i, 1) );
-	}
+	backend.setVertexAttribute(0, 4, sizeof(QuadData), offsetof(QuadData, color), 1);
+	backend.setVertexAttribute(1, 4, sizeof(QuadData), offsetof(QuadData, textureRect), 1);
+	backend.setVertexAttribute(2, 2, sizeof(QuadData), offsetof(QuadData, position), 1);
+	backend.setVertexAttribute(3, 2, sizeof(QuadData), offsetof(QuadData, size), 1);
+	backend.setVertexAttribute(4, 2, sizeof(QuadData), offsetof(QuadData, rotationOrigin), 1);
+	backend.setVertexAttribute(5, 1, sizeof(QuadData), offsetof(QuadData, rotation), 1);
+	backend.setVertexAttribute(6, 1, sizeof(QuadData), offsetof(QuadData, textureSlotRef), 1);
 
 	mWhiteTexture = new Texture;
 	unsigned whiteData = 0xffffffff;
@@ -113,8 +105,8 @@ void QuadRenderer::shutDown()
 {
 	delete mWhiteTexture;
 	mQuadIBO.remove();
-	GLCheck( glDeleteBuffers(1, &mQuadsDataVBO) );
-	GLCheck( glDeleteVertexArrays(1, &mVAO) );
+	RenderingBackend::getCurrent().deleteBuffer(mQuadsDataVBO);
+	RenderingBackend::getCurrent().deleteVertexArray(mVAO);
 }
 
 void QuadRenderer::setDebugNumbersToZero()
@@ -125,7 +117,7 @@ void QuadRenderer::setDebugNumbersToZero()
 	mNumberOfRenderGroups = 0;
 }
 
-void QuadRenderer::submitBunchOfQuadsWithTheSameTexture(std::vector<QuadData>& quadsData, const Texture* texture,
+void QuadRenderer::submitBunchOfQuadsWithTheSameTexture(QuadData* quadsData, size_t nrOfQuads, const Texture* texture,
                                                         const Shader* shader, float z)
 {
 	// NOTE: this function doesn't do any culling
@@ -139,17 +131,17 @@ void QuadRenderer::submitBunchOfQuadsWithTheSameTexture(std::vector<QuadData>& q
 		texture = mWhiteTexture;
 	auto textureSlotOfThisTexture = getTextureSlotToWhichThisTextureIsBound(texture, renderGroup);
 	if(textureSlotOfThisTexture) {
-		for(auto& quad : quadsData)
-			quad.textureSlotRef = *textureSlotOfThisTexture;
+		for(size_t i = 0; i < nrOfQuads; ++i)
+			quadsData[i].textureSlotRef = *textureSlotOfThisTexture;
 	}
 	else {
 		const float textureSlotID = static_cast<float>(renderGroup.textures.size());
-		for(auto& quad : quadsData)
-			quad.textureSlotRef = textureSlotID;
+		for(size_t i = 0; i < nrOfQuads; ++i)
+			quadsData[i].textureSlotRef = textureSlotID;
 		renderGroup.textures.emplace_back(texture);
 	}
 
-	renderGroup.quadsData.insert(renderGroup.quadsData.end(), quadsData.begin(), quadsData.end());
+	renderGroup.quadsData.insert(renderGroup.quadsData.end(), quadsData, quadsData + nrOfQuads);
 }
 
 void QuadRenderer::submitQuad(const Texture* texture, const IntRect* textureRect, const sf::Color* color, const Shader* shader,
@@ -286,11 +278,12 @@ void QuadRenderer::bindTexturesForNextDrawCall(std::vector<const Texture*>& text
 
 void QuadRenderer::drawCall(unsigned nrOfInstances, std::vector<QuadData>& quadsData)
 {
-	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
-	GLCheck( glBufferData(GL_ARRAY_BUFFER, nrOfInstances * sizeof(QuadData), quadsData.data(), GL_STATIC_DRAW) );
+	auto& backend = RenderingBackend::getCurrent();
+	backend.bindBuffer(BufferType::Vertex, mQuadsDataVBO);
+	backend.setBufferData(BufferType::Vertex, nrOfInstances * sizeof(QuadData), quadsData.data(), BufferUsage::Static);
 
-	GLCheck( glBindVertexArray(mVAO) );
-	GLCheck( glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, nrOfInstances) );
+	backend.bindVertexArray(mVAO);
+	backend.drawIndexedInstanced(PrimitiveType::Triangles, 6, nrOfInstances);
 
 	++mNumberOfDrawCalls;
 }
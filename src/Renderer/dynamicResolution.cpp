@@ -0,0 +1,65 @@
+#include "dynamicResolution.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ph {
+
+DynamicResolutionController::DynamicResolutionController()
+	:mScale(1.f)
+	,mAverageFrameTime(0.f)
+	,mFrameTimesSumOfWindow(0.f)
+	,mFramesOfWindow(0)
+	,mFramesOverBudgetOfWindow(0)
+{
+}
+
+void DynamicResolutionController::update(float frameTime)
+{
+	if(!mSettings.isActive)
+		return;
+
+	mFrameTimesSumOfWindow += frameTime;
+	if(frameTime > mSettings.targetFrameTime)
+		++mFramesOverBudgetOfWindow;
+	if(++mFramesOfWindow < mSettings.framesBetweenChanges)
+		return;
+
+	mAverageFrameTime = mFrameTimesSumOfWindow / mFramesOfWindow;
+	const bool isMostOfWindowOverBudget = mFramesOverBudgetOfWindow * 2 > mFramesOfWindow;
+	mFrameTimesSumOfWindow = 0.f;
+	mFramesOfWindow = 0;
+	mFramesOverBudgetOfWindow = 0;
+
+	const float headroomRatio = 0.8f;
+	float newScale = mScale;
+	if(isMostOfWindowOverBudget && mAverageFrameTime > mSettings.targetFrameTime)
+	{
+		// fill cost is proportional to the number of pixels so to the square of the scale
+		const float desiredScale = mScale * std::sqrt(mSettings.targetFrameTime / mAverageFrameTime);
+		newScale = std::min(quantize(desiredScale), mScale - mSettings.scaleStep);
+	}
+	else if(mAverageFrameTime < mSettings.targetFrameTime * headroomRatio)
+	{
+		newScale = mScale + mSettings.scaleStep;
+	}
+
+	mScale = std::clamp(quantize(newScale), mSettings.minScale, mSettings.maxScale);
+}
+
+void DynamicResolutionController::setSettings(const DynamicResolutionSettings& settings)
+{
+	mSettings = settings;
+	if(!mSettings.isActive)
+		mScale = mSettings.maxScale;
+	mScale = std::clamp(mScale, mSettings.minScale, mSettings.maxScale);
+	mFrameTimesSumOfWindow = 0.f;
+	mFramesOfWindow = 0;
+	mFramesOverBudgetOfWindow = 0;
+}
+
+float DynamicResolutionController::quantize(float scale) const
+{
+	return std::round(scale / mSettings.scaleStep) * mSettings.scaleStep;
+}
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+namespace ph {
+
+struct DynamicResolutionSettings
+{
+	float targetFrameTime = 16.6f; // in milliseconds
+	float minScale = 0.5f;
+	float maxScale = 1.f;
+	float scaleStep = 0.05f;
+	unsigned framesBetweenChanges = 15;
+	bool isActive = true;
+};
+
+// Chooses the scale of game objects and lighting framebuffers from measured GPU frame time.
+// Frame times are gathered in windows of framesBetweenChanges frames. Scale goes down when most frames
+// of the window didn't fit into target frame time and goes up only one step at a time when there is a lot of headroom,
+// so single spikes are ignored and scale doesn't oscillate.
+
+class DynamicResolutionController
+{
+public:
+	DynamicResolutionController();
+
+	void update(float frameTime);
+
+	void setSettings(const DynamicResolutionSettings&);
+	const DynamicResolutionSettings& getSettings() const { return mSettings; }
+
+	float getScale() const { return mScale; }
+	float getAverageFrameTime() const { return mAverageFrameTime; }
+
+private:
+	float quantize(float scale) const;
+
+private:
+	DynamicResolutionSettings mSettings;
+	float mScale;
+	float mAverageFrameTime;
+	float mFrameTimesSumOfWindow;
+	unsigned mFramesOfWindow;
+	unsigned mFramesOverBudgetOfWindow;
+};
+
+}
@@ -0,0 +1,55 @@
+#include "framebufferPool.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+
+namespace ph {
+
+Framebuffer* FramebufferPool::acquire(sf::Vector2u size)
+{
+	for(auto& pooled : mFramebuffers)
+	{
+		if(!pooled.isInUse && pooled.size == size) {
+			pooled.isInUse = true;
+			pooled.wasAcquired = true;
+			return pooled.framebuffer.get();
+		}
+	}
+
+	auto framebuffer = std::make_unique<Framebuffer>();
+	framebuffer->init(size.x, size.y, false);
+	auto* ptr = framebuffer.get();
+	mFramebuffers.emplace_back(PooledFramebuffer{std::move(framebuffer), size, true, true});
+	return ptr;
+}
+
+void FramebufferPool::release(Framebuffer* framebuffer)
+{
+	auto found = std::find_if(mFramebuffers.begin(), mFramebuffers.end(), [framebuffer](const PooledFramebuffer& pooled) {
+		return pooled.framebuffer.get() == framebuffer;
+	});
+	PH_ASSERT_UNEXPECTED_SITUATION(found != mFramebuffers.end() && found->isInUse, "Released framebuffer wasn't acquired from this pool!");
+	found->isInUse = false;
+}
+
+void FramebufferPool::removeUnusedFramebuffers()
+{
+	for(auto& pooled : mFramebuffers)
+		if(!pooled.wasAcquired && !pooled.isInUse)
+			pooled.framebuffer->remove();
+
+	mFramebuffers.erase(std::remove_if(mFramebuffers.begin(), mFramebuffers.end(), [](const PooledFramebuffer& pooled) {
+		return !pooled.wasAcquired && !pooled.isInUse;
+	}), mFramebuffers.end());
+
+	for(auto& pooled : mFramebuffers)
+		pooled.wasAcquired = false;
+}
+
+void FramebufferPool::clear()
+{
+	for(auto& pooled : mFramebuffers)
+		pooled.framebuffer->remove();
+	mFramebuffers.clear();
+}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "API/framebuffer.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <memory>
+
+namespace ph {
+
+// Owns transient framebuffers of render graph. Framebuffer released by one pass
+// can be acquired by another pass which needs framebuffer of the same size.
+
+class FramebufferPool
+{
+public:
+	Framebuffer* acquire(sf::Vector2u size);
+	void release(Framebuffer*);
+
+	// removes framebuffers which weren't acquired since the previous call, for example ones of old window size
+	void removeUnusedFramebuffers();
+	void clear();
+
+	size_t getNumberOfFramebuffers() const { return mFramebuffers.size(); }
+
+private:
+	struct PooledFramebuffer
+	{
+		std::unique_ptr<Framebuffer> framebuffer;
+		sf::Vector2u size;
+		bool isInUse;
+		bool wasAcquired;
+	};
+	std::vector<PooledFramebuffer> mFramebuffers;
+};
+
+}
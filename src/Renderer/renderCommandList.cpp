@@ -0,0 +1,114 @@
+#include "renderCommandList.hpp"
+#include <algorithm>
+#include <tuple>
+#include <cstdint>
+
+namespace ph {
+
+static auto toSortable(const void* ptr) -> std::uintptr_t
+{
+	return reinterpret_cast<std::uintptr_t>(ptr);
+}
+
+static auto getSortKey(const SubmitQuadCommand& q)
+{
+	const IntRect tr = q.textureRect ? *q.textureRect : IntRect(-1, -1, -1, -1);
+	const sf::Uint32 color = q.color ? q.color->toInteger() : 0xffffffff;
+	return std::make_tuple(q.position.y, q.position.x, q.size.y, q.size.x, q.rotation, q.rotationOrigin.x, q.rotationOrigin.y,
+		color, tr.left, tr.top, tr.width, tr.height);
+}
+
+static auto getSortKey(const SubmitLineCommand& l)
+{
+	return std::make_tuple(l.positionA.y, l.positionA.x, l.positionB.y, l.positionB.x,
+		l.colorA.toInteger(), l.colorB.toInteger(), l.thickness);
+}
+
+static auto getSortKey(const SubmitPointCommand& p)
+{
+	return std::make_tuple(p.z, p.position.y, p.position.x, p.color.toInteger(), p.size);
+}
+
+static auto getSortKey(const Light& l)
+{
+	return std::make_tuple(l.pos.y, l.pos.x, l.startAngle, l.endAngle, l.color.toInteger(),
+		l.attenuationAddition, l.attenuationFactor, l.attenuationSquareFactor);
+}
+
+static auto getSortKey(const SubmitLightBlockingQuadCommand& q)
+{
+	return std::make_tuple(q.position.y, q.position.x, q.size.y, q.size.x);
+}
+
+template<typename Command>
+static void sortCommands(std::vector<Command>& commands, size_t from)
+{
+	std::sort(commands.begin() + from, commands.end(), [](const Command& a, const Command& b) {
+		return getSortKey(a) < getSortKey(b);
+	});
+}
+
+void RenderCommandList::clear()
+{
+	quads.clear();
+	quadsOfBunches.clear();
+	lines.clear();
+	points.clear();
+	lights.clear();
+	lightBlockingQuads.clear();
+	windowResize.reset();
+	hasSceneBegun = false;
+}
+
+void RenderCommandList::append(const RenderCommandList& other)
+{
+	const size_t quadsOfBunchesOffset = quadsOfBunches.size();
+	quadsOfBunches.insert(quadsOfBunches.end(), other.quadsOfBunches.begin(), other.quadsOfBunches.end());
+	for(auto command : other.quads)
+	{
+		if(auto* bunch = std::get_if<SubmitBunchOfQuadsCommand>(&command))
+			bunch->firstQuadIndex += quadsOfBunchesOffset;
+		quads.emplace_back(command);
+	}
+
+	lines.insert(lines.end(), other.lines.begin(), other.lines.end());
+	points.insert(points.end(), other.points.begin(), other.points.end());
+	lights.insert(lights.end(), other.lights.begin(), other.lights.end());
+	lightBlockingQuads.insert(lightBlockingQuads.end(), other.lightBlockingQuads.begin(), other.lightBlockingQuads.end());
+}
+
+void RenderCommandList::sortBySortKey(RenderCommandListMarker from)
+{
+	// quads are sorted by render group first, then by their data
+	auto getRenderGroupKey = [](const auto& command) {
+		return std::make_tuple(command.z, toSortable(command.shader), toSortable(command.texture));
+	};
+	auto getBunchKey = [this](const SubmitBunchOfQuadsCommand& bunch) {
+		const QuadData& firstQuad = quadsOfBunches[bunch.firstQuadIndex];
+		return std::make_tuple(bunch.nrOfQuads, firstQuad.position.y, firstQuad.position.x, firstQuad.size.y, firstQuad.size.x);
+	};
+	std::sort(quads.begin() + from.quads, quads.end(), [&](const auto& a, const auto& b)
+	{
+		const auto groupA = std::visit(getRenderGroupKey, a);
+		const auto groupB = std::visit(getRenderGroupKey, b);
+		if(groupA != groupB)
+			return groupA < groupB;
+		if(a.index() != b.index())
+			return a.index() < b.index();
+		if(auto* quadA = std::get_if<SubmitQuadCommand>(&a))
+			return getSortKey(*quadA) < getSortKey(std::get<SubmitQuadCommand>(b));
+		return getBunchKey(std::get<SubmitBunchOfQuadsCommand>(a)) < getBunchKey(std::get<SubmitBunchOfQuadsCommand>(b));
+	});
+
+	sortCommands(lines, from.lines);
+	sortCommands(points, from.points);
+	sortCommands(lights, from.lights);
+	sortCommands(lightBlockingQuads, from.lightBlockingQuads);
+}
+
+RenderCommandListMarker RenderCommandList::getMarker() const
+{
+	return {quads.size(), lines.size(), points.size(), lights.size(), lightBlockingQuads.size()};
+}
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "MinorRenderers/quadData.hpp"
+#include "MinorRenderers/lightRenderer.hpp"
+#include "Utilities/rect.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <vector>
+#include <variant>
+#include <optional>
+
+namespace ph {
+
+class Texture;
+class Shader;
+
+// Everything what Renderer::submit* functions received during one frame.
+// When render thread is running main thread records frame N+1 into one command list
+// while render thread executes frame N from the other one.
+// Every other thread which submits something records into its own command list,
+// these lists are merged into the frame's list at the end of the frame.
+
+struct SubmitQuadCommand
+{
+	std::optional<IntRect> textureRect;
+	std::optional<sf::Color> color;
+	const Texture* texture;
+	const Shader* shader;
+	sf::Vector2f position;
+	sf::Vector2f size;
+	sf::Vector2f rotationOrigin;
+	float rotation;
+	unsigned char z;
+};
+
+struct SubmitBunchOfQuadsCommand
+{
+	const Texture* texture;
+	const Shader* shader;
+	size_t firstQuadIndex;
+	size_t nrOfQuads;
+	unsigned char z;
+};
+
+struct SubmitLineCommand
+{
+	sf::Color colorA;
+	sf::Color colorB;
+	sf::Vector2f positionA;
+	sf::Vector2f positionB;
+	float thickness;
+};
+
+struct SubmitPointCommand
+{
+	sf::Color color;
+	sf::Vector2f position;
+	float size;
+	unsigned char z;
+};
+
+struct SubmitLightBlockingQuadCommand
+{
+	sf::Vector2f position;
+	sf::Vector2f size;
+};
+
+struct RenderCommandListMarker
+{
+	size_t quads;
+	size_t lines;
+	size_t points;
+	size_t lights;
+	size_t lightBlockingQuads;
+};
+
+struct RenderCommandList
+{
+	void clear();
+
+	// copies commands of the other list to the end of this list
+	void append(const RenderCommandList&);
+
+	// sorts commands added after the marker, so the result of merging lists of many threads
+	// doesn't depend on the order in which these threads submitted their commands
+	void sortBySortKey(RenderCommandListMarker from);
+
+	RenderCommandListMarker getMarker() const;
+
+	// quads and bunches of quads share one vector so the order of submission is preserved
+	std::vector<std::variant<SubmitQuadCommand, SubmitBunchOfQuadsCommand>> quads;
+	std::vector<QuadData> quadsOfBunches;
+	std::vector<SubmitLineCommand> lines;
+	std::vector<SubmitPointCommand> points;
+	std::vector<Light> lights;
+	std::vector<SubmitLightBlockingQuadCommand> lightBlockingQuads;
+	std::optional<sf::Vector2u> windowResize;
+	float viewProjectionMatrix[16];
+	FloatRect screenBounds;
+	sf::Color ambientLightColor;
+	bool hasSceneBegun = false;
+};
+
+}
@@ -0,0 +1,199 @@
+#include <GL/glew.h>
+#include "renderGraph.hpp"
+#include "framebufferPool.hpp"
+#include "API/framebuffer.hpp"
+#include "API/openglErrors.hpp"
+#include "Logs/logs.hpp"
+#include "Utilities/profiling.hpp"
+#include <algorithm>
+
+namespace ph {
+
+RenderPassContext::RenderPassContext(const std::unordered_map<std::string, Framebuffer*>& framebuffers,
+                                     const std::unordered_map<std::string, std::pair<std::string, bool>>& resolvedInputs)
+	:mFramebuffers(framebuffers)
+	,mResolvedInputs(resolvedInputs)
+{
+}
+
+Framebuffer& RenderPassContext::getInput(const std::string& resource) const
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(mResolvedInputs.count(resource), "Pass didn't declare " + resource + " as its input!");
+	return *mFramebuffers.at(mResolvedInputs.at(resource).first);
+}
+
+bool RenderPassContext::isInputFused(const std::string& resource) const
+{
+	return mResolvedInputs.at(resource).second;
+}
+
+void RenderGraph::importFramebuffer(const std::string& resource, Framebuffer* framebuffer)
+{
+	mImportedFramebuffers[resource] = framebuffer;
+}
+
+void RenderGraph::addPass(RenderPass pass)
+{
+	mPasses.emplace_back(std::move(pass));
+}
+
+void RenderGraph::compile(bool shouldFusePasses)
+{
+	mCompiledPasses.clear();
+	mCompiledPasses.resize(mPasses.size());
+
+	// find producers and consumers of resources
+	std::unordered_map<std::string, size_t> producers;
+	std::unordered_map<std::string, std::vector<size_t>> consumers;
+	for(size_t i = 0; i < mPasses.size(); ++i)
+	{
+		for(const auto& input : mPasses[i].inputs) {
+			PH_ASSERT_UNEXPECTED_SITUATION(producers.count(input.resource) || isImported(input.resource),
+				"Pass " + mPasses[i].name + " reads " + input.resource + " which isn't written by any previous pass!");
+			consumers[input.resource].emplace_back(i);
+			mCompiledPasses[i].resolvedInputs[input.resource] = {input.resource, false};
+		}
+		if(!mPasses[i].output.empty()) {
+			PH_ASSERT_UNEXPECTED_SITUATION(!producers.count(mPasses[i].output) && !isImported(mPasses[i].output),
+				"Resource " + mPasses[i].output + " is written more than once!");
+			producers[mPasses[i].output] = i;
+		}
+	}
+
+	// skip passes whose output is never read, going backwards so whole dead chains are skipped
+	for(size_t i = mPasses.size(); i-- > 0;)
+	{
+		const auto& output = mPasses[i].output;
+		if(output.empty())
+			continue;
+		const auto& readers = consumers[output];
+		const bool isRead = std::any_of(readers.begin(), readers.end(), [this](size_t reader) {
+			return mCompiledPasses[reader].isExecuted;
+		});
+		mCompiledPasses[i].isExecuted = isRead;
+	}
+
+	// fuse passes into their consumers
+	if(shouldFusePasses)
+	{
+		for(size_t i = 0; i < mPasses.size(); ++i)
+		{
+			const auto& pass = mPasses[i];
+			if(!pass.canBeFusedIntoConsumer || pass.inputs.size() != 1 || pass.output.empty() || !mCompiledPasses[i].isExecuted)
+				continue;
+
+			const auto& readers = consumers[pass.output];
+			if(readers.size() != 1)
+				continue;
+			const size_t consumer = readers.front();
+			const auto& consumerInputs = mPasses[consumer].inputs;
+			auto consumerInput = std::find_if(consumerInputs.begin(), consumerInputs.end(), [&pass](const RenderPassInput& input) {
+				return input.resource == pass.output;
+			});
+			if(!consumerInput->acceptsFusedPass)
+				continue;
+
+			// fused producer's input has to be resolved too, in case it was fused as well
+			mCompiledPasses[consumer].resolvedInputs[pass.output] = {mCompiledPasses[i].resolvedInputs.begin()->second.first, true};
+			consumers[mCompiledPasses[i].resolvedInputs.begin()->second.first].emplace_back(consumer);
+			mCompiledPasses[i].isExecuted = false;
+			mCompiledPasses[i].isFused = true;
+		}
+	}
+
+	// release transient resources right after their last reader
+	std::unordered_map<std::string, size_t> lastReaders;
+	for(size_t i = 0; i < mPasses.size(); ++i)
+		if(mCompiledPasses[i].isExecuted)
+			for(const auto& [input, resolvedInput] : mCompiledPasses[i].resolvedInputs)
+				if(!isImported(resolvedInput.first))
+					lastReaders[resolvedInput.first] = i;
+	for(const auto& [resource, lastReader] : lastReaders)
+		mCompiledPasses[lastReader].resourcesToReleaseAfterExecution.emplace_back(resource);
+
+	// count how many transient framebuffers will be needed at the same time
+	unsigned alive = 0;
+	mMaxNumberOfTransientResourcesAlive = 0;
+	for(size_t i = 0; i < mPasses.size(); ++i)
+	{
+		if(!mCompiledPasses[i].isExecuted)
+			continue;
+		if(!mPasses[i].output.empty())
+			++alive;
+		mMaxNumberOfTransientResourcesAlive = std::max(mMaxNumberOfTransientResourcesAlive, alive);
+		alive -= static_cast<unsigned>(mCompiledPasses[i].resourcesToReleaseAfterExecution.size());
+	}
+}
+
+void RenderGraph::execute(FramebufferPool& pool, sf::Vector2u framebuffersSize, sf::Vector2u viewportSize)
+{
+	PH_PROFILE_FUNCTION();
+
+	mFramebuffersOfResources = mImportedFramebuffers;
+
+	for(size_t i = 0; i < mPasses.size(); ++i)
+	{
+		const auto& compiledPass = mCompiledPasses[i];
+		if(!compiledPass.isExecuted)
+			continue;
+
+		const auto& pass = mPasses[i];
+		if(pass.output.empty()) {
+			GLCheck( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+			GLCheck( glViewport(0, 0, framebuffersSize.x, framebuffersSize.y) );
+		}
+		else {
+			Framebuffer* output = pool.acquire(framebuffersSize);
+			mFramebuffersOfResources[pass.output] = output;
+			output->bind();
+			GLCheck( glViewport(0, 0, viewportSize.x, viewportSize.y) );
+		}
+
+		pass.execute(RenderPassContext(mFramebuffersOfResources, compiledPass.resolvedInputs));
+
+		for(const auto& resource : compiledPass.resourcesToReleaseAfterExecution)
+			pool.release(mFramebuffersOfResources[resource]);
+	}
+}
+
+void RenderGraph::clear()
+{
+	mPasses.clear();
+	mCompiledPasses.clear();
+	mImportedFramebuffers.clear();
+	mFramebuffersOfResources.clear();
+}
+
+bool RenderGraph::isPassExecuted(const std::string& passName) const
+{
+	auto* pass = findPass(passName);
+	return pass && pass->isExecuted;
+}
+
+bool RenderGraph::isPassFused(const std::string& passName) const
+{
+	auto* pass = findPass(passName);
+	return pass && pass->isFused;
+}
+
+unsigned RenderGraph::getNumberOfExecutedPasses() const
+{
+	return static_cast<unsigned>(std::count_if(mCompiledPasses.begin(), mCompiledPasses.end(), [](const CompiledPass& pass) {
+		return pass.isExecuted;
+	}));
+}
+
+auto RenderGraph::findPass(const std::string& passName) const -> const CompiledPass*
+{
+	for(size_t i = 0; i < mPasses.size(); ++i)
+		if(mPasses[i].name == passName)
+			return i < mCompiledPasses.size() ? &mCompiledPasses[i] : nullptr;
+	return nullptr;
+}
+
+bool RenderGraph::isImported(const std::string& resource) const
+{
+	return mImportedFramebuffers.count(resource);
+}
+
+}
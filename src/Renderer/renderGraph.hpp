@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+
+namespace ph {
+
+class Framebuffer;
+class FramebufferPool;
+
+struct RenderPassInput
+{
+	std::string resource;
+
+	// consumer is able to apply the effect of the pass which produces this resource by itself,
+	// see RenderPass::canBeFusedIntoConsumer
+	bool acceptsFusedPass = false;
+};
+
+class RenderPassContext
+{
+public:
+	RenderPassContext(const std::unordered_map<std::string, Framebuffer*>& framebuffers,
+	                  const std::unordered_map<std::string, std::pair<std::string, bool>>& resolvedInputs);
+
+	Framebuffer& getInput(const std::string& resource) const;
+
+	// if producer of the resource was fused into this pass getInput() returns input of the producer
+	// and this pass has to apply producer's effect itself
+	bool isInputFused(const std::string& resource) const;
+
+private:
+	const std::unordered_map<std::string, Framebuffer*>& mFramebuffers;
+	const std::unordered_map<std::string, std::pair<std::string, bool>>& mResolvedInputs;
+};
+
+struct RenderPass
+{
+	std::string name;
+	std::vector<RenderPassInput> inputs;
+	std::string output; // empty output means default framebuffer
+	std::function<void(const RenderPassContext&)> execute;
+
+	// pass with single input whose output is read only by one pass which accepts it as fused
+	// isn't executed, so its output never has to be written to and read from memory
+	bool canBeFusedIntoConsumer = false;
+};
+
+// Full screen passes declare which resources they read and write. Render graph executes them in order of adding,
+// skips passes whose output isn't read by anything, fuses passes where it's possible and takes framebuffers
+// for transient resources from resolution keyed pool, giving them back right after their last reader is executed.
+
+class RenderGraph
+{
+public:
+	void importFramebuffer(const std::string& resource, Framebuffer*);
+	void addPass(RenderPass);
+	void compile(bool shouldFusePasses = true);
+	void execute(FramebufferPool&, sf::Vector2u framebuffersSize, sf::Vector2u viewportSize);
+	void clear();
+
+	bool isPassExecuted(const std::string& passName) const;
+	bool isPassFused(const std::string& passName) const;
+	unsigned getNumberOfExecutedPasses() const;
+	unsigned getMaxNumberOfTransientResourcesAlive() const { return mMaxNumberOfTransientResourcesAlive; }
+
+private:
+	struct CompiledPass
+	{
+		// input resource -> resource which is really read and whether it comes from fused pass
+		std::unordered_map<std::string, std::pair<std::string, bool>> resolvedInputs;
+		std::vector<std::string> resourcesToReleaseAfterExecution;
+		bool isExecuted = true;
+		bool isFused = false;
+	};
+
+	auto findPass(const std::string& passName) const -> const CompiledPass*;
+	bool isImported(const std::string& resource) const;
+
+private:
+	std::vector<RenderPass> mPasses;
+	std::vector<CompiledPass> mCompiledPasses;
+	std::unordered_map<std::string, Framebuffer*> mImportedFramebuffers;
+	std::unordered_map<std::string, Framebuffer*> mFramebuffersOfResources;
+	unsigned mMaxNumberOfTransientResourcesAlive = 0;
+};
+
+}
@@ -12,42 +12,96 @@
 #include "Logs/logs.hpp"
 #include "API/openglErrors.hpp"
 #include "API/framebuffer.hpp"
+#include "renderCommandList.hpp"
+#include "dynamicResolution.hpp"
+#include "renderGraph.hpp"
+#include "framebufferPool.hpp"
 #include "Utilities/vector4.hpp"
 #include "Utilities/cast.hpp"
 #include "Utilities/profiling.hpp"
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
 #include <vector>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <condition_variable>
 
 namespace {
 	ph::FloatRect screenBounds;
 
 	ph::Shader* defaultFramebufferShader;
+	ph::Shader* defaultFramebufferWithLightingBlurShader;
 	ph::Shader* gaussianBlurFramebufferShader;
 	
 	ph::VertexArray framebufferVertexArray;
 	ph::Framebuffer gameObjectsFramebuffer;
-	ph::Framebuffer lightingFramebuffer;
-	ph::Framebuffer lightingGaussianBlurFramebuffer;
+	ph::RenderGraph postProcessingGraph;
+	ph::FramebufferPool framebufferPool;
+	sf::Color ambientLightOfCurrentFrame;
 	 
 	sf::Color ambientLightColor;
 
 	unsigned sharedDataUBO;
 
+	sf::Vector2u framebuffersSize;
+	ph::DynamicResolutionController dynamicResolution;
+	ph::DynamicResolutionSettings dynamicResolutionSettings;
+	bool areDynamicResolutionSettingsDirty = false;
+	float resolutionScaleOfCurrentFrame = 1.f;
+	unsigned gpuTimeQueries[2];
+	unsigned nrOfIssuedGpuTimeQueries;
+
 	ph::QuadRenderer quadRenderer;
 	ph::PointRenderer pointRenderer;
 	ph::LineRenderer lineRenderer;
 	ph::SFMLRenderer sfmlRenderer;
 	ph::LightRenderer lightRenderer;
+
+	enum class RenderThreadState { Idle, PresentingFrame, RenderingFrame, LendingContext, ContextLent, ShuttingDown };
+
+	std::thread renderThread;
+	std::thread::id renderThreadID;
+	std::mutex renderThreadMutex;
+	std::condition_variable renderThreadCondition;
+	RenderThreadState renderThreadState;
+	sf::RenderWindow* renderThreadWindow;
+
+	ph::RenderCommandList commandLists[2];
+	ph::RenderCommandList* recordedCommandList = &commandLists[0];
+	ph::RenderCommandList* executedCommandList = &commandLists[1];
+
+	std::thread::id mainThreadID;
+	std::mutex producerCommandListsMutex;
+	std::vector<std::unique_ptr<ph::RenderCommandList>> producerCommandLists;
+	thread_local ph::RenderCommandList* producerCommandListOfThisThread = nullptr;
+	ph::RenderCommandList mergedProducerCommands;
 }
 
 namespace ph {
 
 static void setClearColor(sf::Color);
 static float getNormalizedZ(const unsigned char z);
+static RenderCommandList* getCommandListOfThisThread();
+static void mergeProducerCommandLists(RenderCommandList& target);
+static void renderThreadLoop();
+static void executeCommandList(RenderCommandList&);
+static void submitCommandListToMinorRenderers(RenderCommandList&);
+static void beginSceneOnGPU(const float* viewProjectionMatrix, const FloatRect& bounds);
+static void composeFrame(sf::Color ambientLight);
+static void resizeFramebuffers(unsigned width, unsigned height);
+static void passDebugDataToDebugCounter(DebugCounter&);
+static void setScaledViewport();
+static auto getScaledViewportSize() -> sf::Vector2u;
+static void setUpPostProcessingGraph();
+static void updateDynamicResolution();
 
 void Renderer::init(unsigned screenWidth, unsigned screenHeight)
 {
+	// thread which initializes renderer is the one which ends scenes
+	mainThreadID = std::this_thread::get_id();
+
 	// initialize glew
 	glewExperimental = GL_TRUE;
 	if(glewInit() != GLEW_OK)
@@ -77,6 +131,8 @@ void Renderer::init(unsigned screenWidth, unsigned screenHeight)
 	auto& sl = ShaderLibrary::getInstance();
 	sl.loadFromFile("defaultFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/defaultFramebuffer.fs.glsl");
 	defaultFramebufferShader = sl.get("defaultFramebuffer");
+	sl.loadFromFile("defaultFramebufferWithLightingBlur", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/defaultFramebufferWithLightingBlur.fs.glsl");
+	defaultFramebufferWithLightingBlurShader = sl.get("defaultFramebufferWithLightingBlur");
 	sl.loadFromFile("gaussianBlurFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/gaussianBlur.fs.glsl");
 	gaussianBlurFramebufferShader = sl.get("gaussianBlurFramebuffer");
 
@@ -100,8 +156,12 @@ void Renderer::init(unsigned screenWidth, unsigned screenHeight)
 	framebufferVertexArray.setIndexBuffer(quadIBO);
 
 	gameObjectsFramebuffer.init(screenWidth, screenHeight);
-	lightingFramebuffer.init(screenWidth, screenHeight);
-	lightingGaussianBlurFramebuffer.init(screenWidth, screenHeight);
+	framebuffersSize = sf::Vector2u(screenWidth, screenHeight);
+	setUpPostProcessingGraph();
+
+	// set up measuring of gpu frame time for dynamic resolution
+	GLCheck( glGenQueries(2, gpuTimeQueries) );
+	nrOfIssuedGpuTimeQueries = 0;
 }
 
 void Renderer::restart(unsigned screenWidth, unsigned screenHeight)
@@ -112,100 +172,184 @@ void Renderer::restart(unsigned screenWidth, unsigned screenHeight)
 
 void Renderer::shutDown()
 {
+	if(isRenderThreadRunning())
+		stopRenderThread();
+
 	quadRenderer.shutDown();
 	lineRenderer.shutDown();
 	lightRenderer.shutDown();
 	framebufferVertexArray.remove();
 	gameObjectsFramebuffer.remove();
-	lightingFramebuffer.remove();
-	lightingGaussianBlurFramebuffer.remove();
+	postProcessingGraph.clear();
+	framebufferPool.clear();
+	GLCheck( glDeleteQueries(2, gpuTimeQueries) );
+}
+
+void Renderer::startRenderThread(sf::RenderWindow& window)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(!isRenderThreadRunning(), "Render thread is already running!");
+
+	recordedCommandList->clear();
+	executedCommandList->clear();
+	renderThreadState = RenderThreadState::Idle;
+	renderThreadWindow = &window;
+
+	// GL context can be active only on one thread at the same time
+	window.setActive(false);
+	renderThread = std::thread(renderThreadLoop);
+	renderThreadID = renderThread.get_id();
+}
+
+void Renderer::stopRenderThread()
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(isRenderThreadRunning(), "Render thread is not running!");
+
+	{
+		std::unique_lock<std::mutex> lock(renderThreadMutex);
+		renderThreadCondition.wait(lock, [] { return renderThreadState == RenderThreadState::Idle; });
+		renderThreadState = RenderThreadState::ShuttingDown;
+	}
+	renderThreadCondition.notify_all();
+	renderThread.join();
+	renderThreadID = std::thread::id();
+
+	renderThreadWindow->setActive(true);
+	renderThreadWindow = nullptr;
+	recordedCommandList->clear();
+}
+
+bool Renderer::isRenderThreadRunning()
+{
+	return renderThread.joinable();
+}
+
+void Renderer::acquireGLContextOnMainThread()
+{
+	if(!isRenderThreadRunning())
+		return;
+
+	std::unique_lock<std::mutex> lock(renderThreadMutex);
+	renderThreadCondition.wait(lock, [] { return renderThreadState == RenderThreadState::Idle; });
+	renderThreadState = RenderThreadState::LendingContext;
+	renderThreadCondition.notify_all();
+	renderThreadCondition.wait(lock, [] { return renderThreadState == RenderThreadState::ContextLent; });
+	renderThreadWindow->setActive(true);
+}
+
+void Renderer::releaseGLContextFromMainThread()
+{
+	if(!isRenderThreadRunning())
+		return;
+
+	std::unique_lock<std::mutex> lock(renderThreadMutex);
+	PH_ASSERT_UNEXPECTED_SITUATION(renderThreadState == RenderThreadState::ContextLent, "Main thread doesn't have GL context!");
+	renderThreadWindow->setActive(false);
+	renderThreadState = RenderThreadState::Idle;
+	renderThreadCondition.notify_all();
 }
 
 void Renderer::beginScene(Camera& camera)
 {
 	PH_PROFILE_FUNCTION();
 
-	gameObjectsFramebuffer.bind();
-	GLCheck( glEnable(GL_DEPTH_TEST) );
-	GLCheck( glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) );
-
 	const float* viewProjectionMatrix = camera.getViewProjectionMatrix4x4().getMatrix();
-	GLCheck( glBindBuffer(GL_UNIFORM_BUFFER, sharedDataUBO) );
-	GLCheck( glBufferSubData(GL_UNIFORM_BUFFER, 0, 16 * sizeof(float), viewProjectionMatrix) );
-	
 	const sf::Vector2f center = camera.getCenter();
 	const sf::Vector2f size = camera.getSize();
-	screenBounds = FloatRect(center.x - size.x / 2, center.y - size.y / 2, size.x, size.y);
+	const FloatRect bounds(center.x - size.x / 2, center.y - size.y / 2, size.x, size.y);
+
+	PH_ASSERT_UNEXPECTED_SITUATION(std::this_thread::get_id() == mainThreadID, "Scene can be began only by main thread!");
+
+	if(auto* commandList = getCommandListOfThisThread()) {
+		std::copy(viewProjectionMatrix, viewProjectionMatrix + 16, commandList->viewProjectionMatrix);
+		commandList->screenBounds = bounds;
+		commandList->hasSceneBegun = true;
+	}
+	else {
+		beginSceneOnGPU(viewProjectionMatrix, bounds);
+	}
 }
 
 void Renderer::endScene(sf::RenderWindow& window, DebugCounter& debugCounter)
 {
 	PH_PROFILE_FUNCTION();
 
-	// render scene
-	quadRenderer.flush();
-	pointRenderer.flush();
-
-	// disable depth test for performance purposes
-	GLCheck( glDisable(GL_DEPTH_TEST) );
-
-	// render lights to lighting framebuffer
-	lightingFramebuffer.bind();
-	setClearColor(ambientLightColor);
-	GLCheck( glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) );
-	lightRenderer.flush();
-
-	// user framebuffer vao for both lightingBlurFramebuffer and for default framebuffer
-	framebufferVertexArray.bind();
-
-	// apply gaussian blur for lighting
-	lightingGaussianBlurFramebuffer.bind();
-	GLCheck( glClear(GL_COLOR_BUFFER_BIT) );
-	lightingFramebuffer.bindTextureColorBuffer(0);
-	gaussianBlurFramebufferShader->bind();
-	GLCheck( glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0) );
-
-	// render everything onto quad in default framebuffer
-	GLCheck( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
-	GLCheck( glClear(GL_COLOR_BUFFER_BIT) );
-	defaultFramebufferShader->bind();
-	defaultFramebufferShader->setUniformInt("gameObjectsTexture", 0);
-	gameObjectsFramebuffer.bindTextureColorBuffer(0);
-	defaultFramebufferShader->setUniformInt("lightingTexture", 1);
-	lightingGaussianBlurFramebuffer.bindTextureColorBuffer(1);
-	GLCheck( glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0) );
-
-	// pass debug data to debug counter
-	debugCounter.setAllDrawCallsPerFrame(
-		sfmlRenderer.getNumberOfSubmitedObjects() + quadRenderer.getNumberOfDrawCalls() +
-		lineRenderer.getNumberOfDrawCalls() + pointRenderer.getNrOfDrawCalls()
-	);
-	debugCounter.setNumberOfInstancedDrawCalls(quadRenderer.getNumberOfDrawCalls());
-	debugCounter.setNumberOfRenderGroups(quadRenderer.getNumberOfRenderGroups());
-	debugCounter.setNumberOfDrawnInstancedSprites(quadRenderer.getNumberOfDrawnSprites());
-	debugCounter.setNumberOfTexturesDrawnByInstancedRendering(quadRenderer.getNumberOfDrawnTextures());
-	debugCounter.setNumberOfSFMLDrawCalls(sfmlRenderer.getNumberOfSubmitedObjects());
-	debugCounter.setNumberOfLineDrawCalls(lineRenderer.getNumberOfDrawCalls());
-	debugCounter.setNumberOfDrawnLines(lineRenderer.getNumberOfDrawnLines());
-	debugCounter.setNumberOfPointDrawCalls(pointRenderer.getNrOfDrawCalls());
-	debugCounter.setNumberOfDrawnPoints(pointRenderer.getNrOfDrawnPoints());
-	quadRenderer.setDebugNumbersToZero();
-	lineRenderer.setDebugNumbersToZero();
-	pointRenderer.setDebugNumbersToZero();
-
-	// draw gui using sfml
-	sfmlRenderer.flush(window);
+	if(isRenderThreadRunning())
+	{
+		std::unique_lock<std::mutex> lock(renderThreadMutex);
+
+		// wait until render thread finishes previous frame
+		renderThreadCondition.wait(lock, [] { return renderThreadState == RenderThreadState::Idle; });
+		passDebugDataToDebugCounter(debugCounter);
+		if(areDynamicResolutionSettingsDirty) {
+			dynamicResolution.setSettings(dynamicResolutionSettings);
+			areDynamicResolutionSettingsDirty = false;
+		}
+
+		// hand recorded frame over to render thread
+		mergeProducerCommandLists(*recordedCommandList);
+		recordedCommandList->ambientLightColor = ambientLightColor;
+		std::swap(recordedCommandList, executedCommandList);
+		renderThreadState = RenderThreadState::PresentingFrame;
+		renderThreadCondition.notify_all();
+
+		// gui isn't double buffered so we have to wait until render thread draws it
+		renderThreadCondition.wait(lock, [] { return renderThreadState != RenderThreadState::PresentingFrame; });
+		recordedCommandList->clear();
+	}
+	else
+	{
+		if(areDynamicResolutionSettingsDirty) {
+			dynamicResolution.setSettings(dynamicResolutionSettings);
+			areDynamicResolutionSettingsDirty = false;
+		}
+		mergedProducerCommands.clear();
+		mergeProducerCommandLists(mergedProducerCommands);
+		submitCommandListToMinorRenderers(mergedProducerCommands);
+		composeFrame(ambientLightColor);
+		passDebugDataToDebugCounter(debugCounter);
+		sfmlRenderer.flush(window);
+		window.display();
+	}
 }
 
 void Renderer::submitQuad(const Texture* texture, const IntRect* textureRect, const sf::Color* color, const Shader* shader,
                           sf::Vector2f position, sf::Vector2f size, unsigned char z, float rotation, sf::Vector2f rotationOrigin)
 {
+	if(auto* commandList = getCommandListOfThisThread()) {
+		SubmitQuadCommand command;
+		if(textureRect)
+			command.textureRect = *textureRect;
+		if(color)
+			command.color = *color;
+		command.texture = texture;
+		command.shader = shader;
+		command.position = position;
+		command.size = size;
+		command.rotationOrigin = rotationOrigin;
+		command.rotation = rotation;
+		command.z = z;
+		commandList->quads.emplace_back(command);
+		return;
+	}
+
 	quadRenderer.submitQuad(texture, textureRect, color, shader, position, size, getNormalizedZ(z), rotation, rotationOrigin);
 }
 
 void Renderer::submitBunchOfQuadsWithTheSameTexture(std::vector<QuadData>& qd, const Texture* t, const Shader* s, unsigned char z)
 {
-	quadRenderer.submitBunchOfQuadsWithTheSameTexture(qd, t, s, getNormalizedZ(z));
+	submitBunchOfQuadsWithTheSameTexture(qd.data(), qd.size(), t, s, z);
+}
+
+void Renderer::submitBunchOfQuadsWithTheSameTexture(QuadData* qd, size_t nrOfQuads, const Texture* t, const Shader* s, unsigned char z)
+{
+	if(auto* commandList = getCommandListOfThisThread()) {
+		auto& quadsOfBunches = commandList->quadsOfBunches;
+		commandList->quads.emplace_back(SubmitBunchOfQuadsCommand{t, s, quadsOfBunches.size(), nrOfQuads, z});
+		quadsOfBunches.insert(quadsOfBunches.end(), qd, qd + nrOfQuads);
+		return;
+	}
+
+	quadRenderer.submitBunchOfQuadsWithTheSameTexture(qd, nrOfQuads, t, s, getNormalizedZ(z));
 }
 
 void Renderer::submitLine(sf::Color color, const sf::Vector2f positionA, const sf::Vector2f positionB, float thickness)
@@ -216,22 +360,42 @@ void Renderer::submitLine(sf::Color color, const sf::Vector2f positionA, const s
 void Renderer::submitLine(sf::Color colorA, sf::Color colorB,
                           const sf::Vector2f positionA, const sf::Vector2f positionB, float thickness)
 {
+	if(auto* commandList = getCommandListOfThisThread()) {
+		commandList->lines.emplace_back(SubmitLineCommand{colorA, colorB, positionA, positionB, thickness});
+		return;
+	}
+
 	lineRenderer.drawLine(colorA, colorB, positionA, positionB, thickness);
 }
 
 void Renderer::submitPoint(sf::Vector2f position, sf::Color color, unsigned char z, float size)
 {
+	if(auto* commandList = getCommandListOfThisThread()) {
+		commandList->points.emplace_back(SubmitPointCommand{color, position, size, z});
+		return;
+	}
+
 	pointRenderer.submitPoint(position, color, getNormalizedZ(z), size);
 }
 
 void Renderer::submitLight(sf::Color color, sf::Vector2f position, float startAngle, float endAngle,
                            float attenuationAddition, float attenuationFactor, float attenuationSquareFactor) 
 {
+	if(auto* commandList = getCommandListOfThisThread()) {
+		commandList->lights.emplace_back(Light{color, position, startAngle, endAngle, attenuationAddition, attenuationFactor, attenuationSquareFactor});
+		return;
+	}
+
 	lightRenderer.submitLight({color, position, startAngle, endAngle, attenuationAddition, attenuationFactor, attenuationSquareFactor});
 }
 
 void Renderer::submitLightBlockingQuad(sf::Vector2f position, sf::Vector2f size)
 {
+	if(auto* commandList = getCommandListOfThisThread()) {
+		commandList->lightBlockingQuads.emplace_back(SubmitLightBlockingQuadCommand{position, size});
+		return;
+	}
+
 	lightRenderer.submitLightBlockingQuad(position, size);
 }
 
@@ -242,9 +406,12 @@ void Renderer::submitSFMLObject(const sf::Drawable& object)
 
 void Renderer::onWindowResize(unsigned width, unsigned height)
 {
-	GLCheck( glViewport(0, 0, width, height) );
-	gameObjectsFramebuffer.onWindowResize(width, height);
-	lightingFramebuffer.onWindowResize(width, height);
+	PH_ASSERT_UNEXPECTED_SITUATION(std::this_thread::get_id() == mainThreadID, "Window can be resized only by main thread!");
+
+	if(auto* commandList = getCommandListOfThisThread())
+		commandList->windowResize = sf::Vector2u(width, height);
+	else
+		resizeFramebuffers(width, height);
 }
 
 void Renderer::setAmbientLightColor(sf::Color color)
@@ -252,6 +419,276 @@ void Renderer::setAmbientLightColor(sf::Color color)
 	ambientLightColor = color;
 }
 
+void Renderer::setDynamicResolutionSettings(const DynamicResolutionSettings& settings)
+{
+	// settings are passed to the controller at the end of the frame, when render thread doesn't use it
+	dynamicResolutionSettings = settings;
+	areDynamicResolutionSettingsDirty = true;
+}
+
+auto Renderer::getDynamicResolutionSettings() -> const DynamicResolutionSettings&
+{
+	return dynamicResolutionSettings;
+}
+
+RenderCommandList* getCommandListOfThisThread()
+{
+	const auto thisThreadID = std::this_thread::get_id();
+
+	// calls made by render thread itself, for example lighting debug, go straight to minor renderers
+	if(thisThreadID == renderThreadID)
+		return nullptr;
+
+	if(thisThreadID == mainThreadID)
+		return Renderer::isRenderThreadRunning() ? recordedCommandList : nullptr;
+
+	// worker threads record into their own lists, so they don't have to synchronize with each other
+	if(!producerCommandListOfThisThread) {
+		std::lock_guard<std::mutex> lock(producerCommandListsMutex);
+		producerCommandListOfThisThread = producerCommandLists.emplace_back(std::make_unique<RenderCommandList>()).get();
+	}
+	return producerCommandListOfThisThread;
+}
+
+void mergeProducerCommandLists(RenderCommandList& target)
+{
+	PH_PROFILE_FUNCTION();
+
+	std::lock_guard<std::mutex> lock(producerCommandListsMutex);
+	const RenderCommandListMarker marker = target.getMarker();
+	for(auto& producerCommandList : producerCommandLists) {
+		target.append(*producerCommandList);
+		producerCommandList->clear();
+	}
+	target.sortBySortKey(marker);
+}
+
+void renderThreadLoop()
+{
+	renderThreadWindow->setActive(true);
+
+	std::unique_lock<std::mutex> lock(renderThreadMutex);
+	for(;;)
+	{
+		renderThreadCondition.wait(lock, [] { return renderThreadState != RenderThreadState::Idle; });
+
+		switch(renderThreadState)
+		{
+			case RenderThreadState::PresentingFrame:
+			{
+				// gui is drawn on top of previously composed frame while main thread waits
+				sfmlRenderer.flush(*renderThreadWindow);
+				renderThreadState = RenderThreadState::RenderingFrame;
+				lock.unlock();
+				renderThreadCondition.notify_all();
+
+				renderThreadWindow->display();
+				executeCommandList(*executedCommandList);
+
+				lock.lock();
+				renderThreadState = RenderThreadState::Idle;
+				renderThreadCondition.notify_all();
+			} break;
+
+			case RenderThreadState::LendingContext:
+			{
+				renderThreadWindow->setActive(false);
+				renderThreadState = RenderThreadState::ContextLent;
+				renderThreadCondition.notify_all();
+				renderThreadCondition.wait(lock, [] { return renderThreadState != RenderThreadState::ContextLent; });
+				renderThreadWindow->setActive(true);
+			} break;
+
+			case RenderThreadState::ShuttingDown:
+			{
+				renderThreadWindow->setActive(false);
+				return;
+			}
+
+			default:
+				PH_UNEXPECTED_SITUATION("Render thread was woken up in unexpected state!");
+		}
+	}
+}
+
+void executeCommandList(RenderCommandList& commandList)
+{
+	PH_PROFILE_FUNCTION();
+
+	if(commandList.windowResize)
+		resizeFramebuffers(commandList.windowResize->x, commandList.windowResize->y);
+
+	if(commandList.hasSceneBegun)
+		beginSceneOnGPU(commandList.viewProjectionMatrix, commandList.screenBounds);
+
+	submitCommandListToMinorRenderers(commandList);
+	composeFrame(commandList.ambientLightColor);
+}
+
+void submitCommandListToMinorRenderers(RenderCommandList& commandList)
+{
+	for(const auto& line : commandList.lines)
+		lineRenderer.drawLine(line.colorA, line.colorB, line.positionA, line.positionB, line.thickness);
+
+	for(const auto& quadCommand : commandList.quads)
+	{
+		if(auto* quad = std::get_if<SubmitQuadCommand>(&quadCommand)) {
+			quadRenderer.submitQuad(quad->texture, quad->textureRect ? &*quad->textureRect : nullptr, quad->color ? &*quad->color : nullptr,
+				quad->shader, quad->position, quad->size, getNormalizedZ(quad->z), quad->rotation, quad->rotationOrigin);
+		}
+		else {
+			auto& bunch = std::get<SubmitBunchOfQuadsCommand>(quadCommand);
+			quadRenderer.submitBunchOfQuadsWithTheSameTexture(commandList.quadsOfBunches.data() + bunch.firstQuadIndex, bunch.nrOfQuads,
+				bunch.texture, bunch.shader, getNormalizedZ(bunch.z));
+		}
+	}
+
+	for(const auto& point : commandList.points)
+		pointRenderer.submitPoint(point.position, point.color, getNormalizedZ(point.z), point.size);
+
+	for(const auto& light : commandList.lights)
+		lightRenderer.submitLight(light);
+
+	for(const auto& quad : commandList.lightBlockingQuads)
+		lightRenderer.submitLightBlockingQuad(quad.position, quad.size);
+}
+
+void beginSceneOnGPU(const float* viewProjectionMatrix, const FloatRect& bounds)
+{
+	resolutionScaleOfCurrentFrame = dynamicResolution.getScale();
+
+	gameObjectsFramebuffer.bind();
+	setScaledViewport();
+	GLCheck( glEnable(GL_DEPTH_TEST) );
+	GLCheck( glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) );
+
+	GLCheck( glBindBuffer(GL_UNIFORM_BUFFER, sharedDataUBO) );
+	GLCheck( glBufferSubData(GL_UNIFORM_BUFFER, 0, 16 * sizeof(float), viewProjectionMatrix) );
+
+	screenBounds = bounds;
+}
+
+void composeFrame(sf::Color ambientLight)
+{
+	PH_PROFILE_FUNCTION();
+
+	GLCheck( glBeginQuery(GL_TIME_ELAPSED, gpuTimeQueries[nrOfIssuedGpuTimeQueries % 2]) );
+
+	// render scene
+	quadRenderer.flush();
+	pointRenderer.flush();
+
+	// disable depth test for performance purposes
+	GLCheck( glDisable(GL_DEPTH_TEST) );
+
+	ambientLightOfCurrentFrame = ambientLight;
+	postProcessingGraph.execute(framebufferPool, framebuffersSize, getScaledViewportSize());
+	framebufferPool.removeUnusedFramebuffers();
+
+	GLCheck( glEndQuery(GL_TIME_ELAPSED) );
+	++nrOfIssuedGpuTimeQueries;
+	updateDynamicResolution();
+}
+
+void setScaledViewport()
+{
+	const sf::Vector2u viewportSize = getScaledViewportSize();
+	GLCheck( glViewport(0, 0, viewportSize.x, viewportSize.y) );
+}
+
+auto getScaledViewportSize() -> sf::Vector2u
+{
+	return sf::Vector2u(
+		static_cast<unsigned>(framebuffersSize.x * resolutionScaleOfCurrentFrame),
+		static_cast<unsigned>(framebuffersSize.y * resolutionScaleOfCurrentFrame));
+}
+
+void setUpPostProcessingGraph()
+{
+	postProcessingGraph.importFramebuffer("gameObjects", &gameObjectsFramebuffer);
+
+	// render lights to lighting framebuffer
+	postProcessingGraph.addPass({"lighting", {}, "lighting", [](const RenderPassContext&)
+	{
+		setClearColor(ambientLightOfCurrentFrame);
+		GLCheck( glClear(GL_COLOR_BUFFER_BIT) );
+		lightRenderer.flush();
+	}});
+
+	// apply gaussian blur for lighting
+	RenderPass lightingBlur{"lightingBlur", {{"lighting"}}, "blurredLighting", [](const RenderPassContext& context)
+	{
+		framebufferVertexArray.bind();
+		context.getInput("lighting").bindTextureColorBuffer(0);
+		gaussianBlurFramebufferShader->bind();
+		gaussianBlurFramebufferShader->setUniformFloat("resolutionScale", resolutionScaleOfCurrentFrame);
+		GLCheck( glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0) );
+	}};
+	lightingBlur.canBeFusedIntoConsumer = true;
+	postProcessingGraph.addPass(lightingBlur);
+
+	// render everything onto quad in default framebuffer, scaled down part of framebuffers is stretched onto whole window
+	postProcessingGraph.addPass({"composition", {{"gameObjects"}, {"blurredLighting", true}}, "", [](const RenderPassContext& context)
+	{
+		Shader* shader = context.isInputFused("blurredLighting") ? defaultFramebufferWithLightingBlurShader : defaultFramebufferShader;
+		GLCheck( glClear(GL_COLOR_BUFFER_BIT) );
+		framebufferVertexArray.bind();
+		shader->bind();
+		shader->setUniformFloat("resolutionScale", resolutionScaleOfCurrentFrame);
+		shader->setUniformInt("gameObjectsTexture", 0);
+		context.getInput("gameObjects").bindTextureColorBuffer(0);
+		shader->setUniformInt("lightingTexture", 1);
+		context.getInput("blurredLighting").bindTextureColorBuffer(1);
+		GLCheck( glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0) );
+	}});
+
+	postProcessingGraph.compile();
+}
+
+void updateDynamicResolution()
+{
+	// read the query of the previous frame, so we don't stall waiting for gpu
+	if(nrOfIssuedGpuTimeQueries < 2)
+		return;
+
+	const unsigned query = gpuTimeQueries[nrOfIssuedGpuTimeQueries % 2];
+	GLint isResultAvailable = GL_FALSE;
+	GLCheck( glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &isResultAvailable) );
+	if(isResultAvailable) {
+		GLuint64 frameTimeInNanoseconds;
+		GLCheck( glGetQueryObjectui64v(query, GL_QUERY_RESULT, &frameTimeInNanoseconds) );
+		dynamicResolution.update(frameTimeInNanoseconds / 1000000.f);
+	}
+}
+
+void resizeFramebuffers(unsigned width, unsigned height)
+{
+	GLCheck( glViewport(0, 0, width, height) );
+	gameObjectsFramebuffer.onWindowResize(width, height);
+	framebuffersSize = sf::Vector2u(width, height);
+}
+
+void passDebugDataToDebugCounter(DebugCounter& debugCounter)
+{
+	debugCounter.setAllDrawCallsPerFrame(
+		sfmlRenderer.getNumberOfSubmitedObjects() + quadRenderer.getNumberOfDrawCalls() +
+		lineRenderer.getNumberOfDrawCalls() + pointRenderer.getNrOfDrawCalls()
+	);
+	debugCounter.setNumberOfInstancedDrawCalls(quadRenderer.getNumberOfDrawCalls());
+	debugCounter.setNumberOfRenderGroups(quadRenderer.getNumberOfRenderGroups());
+	debugCounter.setNumberOfDrawnInstancedSprites(quadRenderer.getNumberOfDrawnSprites());
+	debugCounter.setNumberOfTexturesDrawnByInstancedRendering(quadRenderer.getNumberOfDrawnTextures());
+	debugCounter.setNumberOfSFMLDrawCalls(sfmlRenderer.getNumberOfSubmitedObjects());
+	debugCounter.setNumberOfLineDrawCalls(lineRenderer.getNumberOfDrawCalls());
+	debugCounter.setNumberOfDrawnLines(lineRenderer.getNumberOfDrawnLines());
+	debugCounter.setNumberOfPointDrawCalls(pointRenderer.getNrOfDrawCalls());
+	debugCounter.setNumberOfDrawnPoints(pointRenderer.getNrOfDrawnPoints());
+	debugCounter.setResolutionScale(dynamicResolution.getScale());
+	quadRenderer.setDebugNumbersToZero();
+	lineRenderer.setDebugNumbersToZero();
+	pointRenderer.setDebugNumbersToZero();
+}
+
 void setClearColor(sf::Color color)
 {
 	GLCheck( glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f) );
@@ -1,11 +1,16 @@
 #pragma once
 
 #include "MinorRenderers/quadData.hpp"
+#include "dynamicResolution.hpp"
 #include "Utilities/rect.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <vector>
 
+// 1 - dedicated render thread owns GL context and renders frame N while main thread simulates frame N+1
+// 0 - every GL call is made on the main thread at the end of the frame
+#define PH_RENDER_THREAD 1
+
 namespace sf {
 	class Drawable;
 	class RenderWindow;
@@ -23,6 +28,15 @@ namespace Renderer
 	void init(unsigned screenWidth, unsigned screenHeight);
 	void restart(unsigned screenWidth, unsigned screenHeight);
 	void shutDown();
+
+	void startRenderThread(sf::RenderWindow&);
+	void stopRenderThread();
+	bool isRenderThreadRunning();
+
+	// while render thread is running main thread has to borrow GL context from it before making any GL call,
+	// for example before loading textures and shaders of a new scene
+	void acquireGLContextOnMainThread();
+	void releaseGLContextFromMainThread();
 	
 	void beginScene(Camera&);
 	void endScene(sf::RenderWindow& window, DebugCounter&);
@@ -31,6 +45,7 @@ namespace Renderer
 	                sf::Vector2f size, unsigned char z, float rotation, sf::Vector2f rotationOrigin);
 
 	void submitBunchOfQuadsWithTheSameTexture(std::vector<QuadData>&, const Texture*, const Shader*, unsigned char z);
+	void submitBunchOfQuadsWithTheSameTexture(QuadData*, size_t nrOfQuads, const Texture*, const Shader*, unsigned char z);
 
 	void submitLine(sf::Color, const sf::Vector2f positionA, const sf::Vector2f positionB, float thickness = 1.f);
 
@@ -48,6 +63,9 @@ namespace Renderer
 
 	void setAmbientLightColor(sf::Color);
 
+	void setDynamicResolutionSettings(const DynamicResolutionSettings&);
+	auto getDynamicResolutionSettings() -> const DynamicResolutionSettings&;
+
 	void onWindowResize(unsigned width, unsigned height);
 };
 
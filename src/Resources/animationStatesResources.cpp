@@ -28,7 +28,7 @@ void loadAnimationStatesFromFile(const std::string& filepath)
 		);
 		state.frameCount = data.getAttribute("frameCount").toUnsigned();
 		const std::string stateName = data.getAttribute("name").toString();
-		animation[stateName] = state;
+		animation[StringId::intern(stateName)] = state;
 	}
 	 
 	allAnimationsStateData[filepath] = animation;
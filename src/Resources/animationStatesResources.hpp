@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Utilities/rect.hpp"
+#include "Utilities/stringId.hpp"
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <utility>
 
 namespace ph {
@@ -14,7 +16,7 @@ struct StateData
 	unsigned frameCount;
 };
 
-using AnimationStatesData = std::map<std::string, StateData>;
+using AnimationStatesData = std::unordered_map<StringId, StateData>;
 
 void loadAnimationStatesFromFile(const std::string& filepath);
 AnimationStatesData* getAnimationStates(const std::string& filepath);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Renderer/API/texture.hpp"
+#include "Utilities/stringId.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <memory>
@@ -14,11 +15,12 @@ class ResourceHolder
 {
 public:
     bool load(const std::string& filePath);
-    auto get(const std::string& filePath) -> ResourceType&;
-    bool free(const std::string& filePath);
+    auto get(StringId filePath) -> ResourceType&;
+    bool free(StringId filePath);
 
 private:
-	std::unordered_map< std::string, std::unique_ptr<ResourceType> > mResources;
+	// paths are relative to resources directory, full path is built only when file is loaded
+	std::unordered_map< StringId, std::unique_ptr<ResourceType> > mResources;
 };
 
 using SoundBufferHolder = ResourceHolder<sf::SoundBuffer>;
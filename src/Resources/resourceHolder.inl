@@ -4,13 +4,14 @@
 template< typename ResourceType >
 bool ph::ResourceHolder<ResourceType>::load(const std::string& filePath)
 {
-	std::string fullFilePath = "resources/" + filePath;
-	if (mResources.find(fullFilePath) != mResources.end())
+	const auto filePathId = StringId::intern(filePath);
+	if (mResources.find(filePathId) != mResources.end())
 		return true;
+	std::string fullFilePath = "resources/" + filePath;
 	auto resource = std::make_unique< ResourceType >();
 	if (resource->loadFromFile(fullFilePath))
 	{
-		mResources.insert(std::make_pair(fullFilePath, std::move(resource)));
+		mResources.insert(std::make_pair(filePathId, std::move(resource)));
 		return true;
 	}
 	else
@@ -21,12 +22,12 @@ bool ph::ResourceHolder<ResourceType>::load(const std::string& filePath)
 }
 
 template< typename ResourceType >
-auto ph::ResourceHolder<ResourceType>::get(const std::string& filePath) -> ResourceType &
+auto ph::ResourceHolder<ResourceType>::get(StringId filePath) -> ResourceType &
 {
-	std::string fullFilePath = "resources/" + filePath;
-	auto found = mResources.find(fullFilePath);
+	auto found = mResources.find(filePath);
 	if (found == mResources.end())
 	{
+		const std::string fullFilePath = std::string("resources/") + filePath.getString();
 		PH_LOG_ERROR("You try to get a resource that wasn't loaded: " + fullFilePath);
 		throw std::runtime_error("You try to get a resource that wasn't loaded: " + fullFilePath);
 	}
@@ -34,10 +35,10 @@ auto ph::ResourceHolder<ResourceType>::get(const std::string& filePath) -> Resou
 }
 
 template< typename ResourceType >
-bool ph::ResourceHolder<ResourceType>::free(const std::string& filePath)
+bool ph::ResourceHolder<ResourceType>::free(StringId filePath)
 {
-	std::string fullFilePath = "resources/" + filePath;
-	auto amountOfDeletedResources = mResources.erase(fullFilePath);   // can be equal 0 or 1
+	auto amountOfDeletedResources = mResources.erase(filePath);   // can be equal 0 or 1
 
-	PH_ASSERT_WARNING(amountOfDeletedResources == 1, "You try to free " + fullFilePath + ". A resource with this name does not exist.");
+	PH_ASSERT_WARNING(amountOfDeletedResources == 1, std::string("You try to free resources/") + filePath.getString() + ". A resource with this name does not exist.");
+	return amountOfDeletedResources == 1;
 }
@@ -19,7 +19,6 @@
 #include "ECS/Systems/gunPositioningAndTexture.hpp"
 #include "ECS/Systems/velocityChangingAreas.hpp"
 #include "ECS/Systems/meleeAttacks.hpp"
-#include "ECS/Systems/lifetime.hpp"
 #include "ECS/Systems/animationSystem.hpp"
 #include "ECS/Systems/particleSystem.hpp"
 #include "ECS/Systems/pushingAreas.hpp"
@@ -28,11 +27,18 @@
 #include "ECS/Systems/velocityClear.hpp"
 #include "ECS/Systems/audioSystem.hpp"
 #include "ECS/Systems/zombieSystem.hpp"
+#include "ECS/Systems/zombiePathfinding.hpp"
+#include "ECS/Systems/musicThemes.hpp"
 #include "ECS/Systems/entrances.hpp"
 #include "ECS/Systems/gameplayUI.hpp"
 #include "ECS/Systems/areasDebug.hpp"
 #include "ECS/Systems/cars.hpp"
 #include "ECS/Systems/cutscenesActivating.hpp"
+#include "ECS/Systems/bodyRectsSnapshot.hpp"
+#include "ECS/Systems/spatialHashUpdate.hpp"
+#include "ECS/Systems/sleepingBodies.hpp"
+#include "ECS/Systems/timers.hpp"
+#include "ECS/registryGroups.hpp"
 
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
@@ -47,38 +53,52 @@ Scene::Scene(MusicPlayer& musicPlayer, SoundPlayer& soundPlayer, AIManager& aiMa
 	,mPause(false)
 {
 	terminal.setSceneRegistry(&mRegistry);
+	Groups::createGroups(mRegistry);
 
+	// gameplay is simulated with fixed time step
+	mSystemsQueue.appendFixedStepSystem<system::SpatialHashUpdate>();
+	mSystemsQueue.appendFixedStepSystem<system::BodyRectsSnapshot>();
+	mSystemsQueue.appendFixedStepSystem<system::PlayerMovementInput>(std::ref(aiManager), std::ref(gui), this);
+	mSystemsQueue.appendFixedStepSystem<system::ZombiePathfinding>(&aiManager);
+	mSystemsQueue.appendFixedStepSystem<system::ZombieSystem>();
+	mSystemsQueue.appendFixedStepSystem<system::HostileCollisions>();
+	mSystemsQueue.appendFixedStepSystem<system::KinematicCollisions>();
+	mSystemsQueue.appendFixedStepSystem<system::PickupItems>();
+	mSystemsQueue.appendFixedStepSystem<system::StaticCollisions>();
+	mSystemsQueue.appendFixedStepSystem<system::IsPlayerAlive>();
+	mSystemsQueue.appendFixedStepSystem<system::VelocityChangingAreas>();
+	mSystemsQueue.appendFixedStepSystem<system::PushingAreas>();
+	mSystemsQueue.appendFixedStepSystem<system::HintAreas>(std::ref(gui));
+	mSystemsQueue.appendFixedStepSystem<system::GunPositioningAndTexture>();
+	mSystemsQueue.appendFixedStepSystem<system::GunAttacks>();
+	mSystemsQueue.appendFixedStepSystem<system::MeleeAttacks>();
+	mSystemsQueue.appendFixedStepSystem<system::DamageAndDeath>(std::ref(gui), std::ref(aiManager));
+	mSystemsQueue.appendFixedStepSystem<system::Levers>();
+	mSystemsQueue.appendFixedStepSystem<system::SleepingBodies>();
+	mSystemsQueue.appendFixedStepSystem<system::Movement>();
+	mSystemsQueue.appendFixedStepSystem<system::PushingMovement>();
+	mSystemsQueue.appendFixedStepSystem<system::Gates>();
+	mSystemsQueue.appendFixedStepSystem<system::Timers>();
+	mSystemsQueue.appendFixedStepSystem<system::VelocityClear>();
+	mSystemsQueue.appendFixedStepSystem<system::EntityDestroying>();
+	mSystemsQueue.appendFixedStepSystem<system::Entrances>(std::ref(sceneManager));
+	mSystemsQueue.appendFixedStepSystem<system::Cars>();
+	mSystemsQueue.appendFixedStepSystem<system::CutScenesActivating>(std::ref(mCutSceneManager), std::ref(gui), std::ref(musicPlayer), std::ref(soundPlayer), std::ref(aiManager), std::ref(sceneManager));
+	mSystemsQueue.appendFixedStepSystem<system::MusicThemes>(std::ref(musicPlayer));
+
+	// presentation is updated once per frame, render system has to begin renderer scene before other systems submit
+	mSystemsQueue.appendSystem<system::PlayerCameraMovement>();
+	mSystemsQueue.appendSystem<system::AnimationSystem>();
 	mSystemsQueue.appendSystem<system::RenderSystem>(std::ref(tilesetTexture));
 	mSystemsQueue.appendSystem<system::PatricleSystem>();
 	mSystemsQueue.appendSystem<system::GameplayUI>(std::ref(gui));
-	mSystemsQueue.appendSystem<system::PlayerMovementInput>(std::ref(aiManager), std::ref(gui), this);
-	mSystemsQueue.appendSystem<system::ZombieSystem>(&aiManager);
-	mSystemsQueue.appendSystem<system::HostileCollisions>();
-	mSystemsQueue.appendSystem<system::KinematicCollisions>();
-	mSystemsQueue.appendSystem<system::PlayerCameraMovement>();
-	mSystemsQueue.appendSystem<system::PickupItems>();
-	mSystemsQueue.appendSystem<system::StaticCollisions>();
 	mSystemsQueue.appendSystem<system::AreasDebug>();
-	mSystemsQueue.appendSystem<system::IsPlayerAlive>();
-	mSystemsQueue.appendSystem<system::VelocityChangingAreas>();
-	mSystemsQueue.appendSystem<system::PushingAreas>();
-	mSystemsQueue.appendSystem<system::HintAreas>(std::ref(gui));
-	mSystemsQueue.appendSystem<system::GunPositioningAndTexture>();
-	mSystemsQueue.appendSystem<system::GunAttacks>();
-	mSystemsQueue.appendSystem<system::MeleeAttacks>();
-	mSystemsQueue.appendSystem<system::DamageAndDeath>(std::ref(gui), std::ref(aiManager));
-	mSystemsQueue.appendSystem<system::Levers>();
-	mSystemsQueue.appendSystem<system::Movement>();
-	mSystemsQueue.appendSystem<system::PushingMovement>();
-	mSystemsQueue.appendSystem<system::Gates>();
-	mSystemsQueue.appendSystem<system::Lifetime>();
-	mSystemsQueue.appendSystem<system::AnimationSystem>();
-	mSystemsQueue.appendSystem<system::VelocityClear>();
-	mSystemsQueue.appendSystem<system::EntityDestroying>();
-	mSystemsQueue.appendSystem<system::Entrances>(std::ref(sceneManager));
-	mSystemsQueue.appendSystem<system::AudioSystem>(std::ref(musicPlayer), std::ref(soundPlayer));
-	mSystemsQueue.appendSystem<system::Cars>();
-	mSystemsQueue.appendSystem<system::CutScenesActivating>(std::ref(mCutSceneManager), std::ref(gui), std::ref(musicPlayer), std::ref(soundPlayer), std::ref(aiManager), std::ref(sceneManager));
+	mSystemsQueue.appendSystem<system::AudioSystem>(std::ref(soundPlayer));
+
+	// these systems don't have to react immediately, their updates are spread across frames
+	mSystemsQueue.setUpdateInterval<system::ZombiePathfinding>(4);
+	mSystemsQueue.setUpdateInterval<system::MusicThemes>(15);
+	mSystemsQueue.setUpdateInterval<system::GameplayUI>(6);
 }
 
 void Scene::handleEvent(const ActionEvent& event)
@@ -102,10 +122,9 @@ void Scene::update(sf::Time dt)
 void Scene::setPlayerStatus(const PlayerStatus& status)
 {
 	auto playerView = mRegistry.view<component::Bullets, component::Health, component::Player>();
-	auto& [bullets, health] = playerView.get<component::Bullets, component::Health>(*playerView.begin());
-	bullets.numOfPistolBullets = status.numOfPistolBullets;
-	bullets.numOfShotgunBullets = status.numOfShotgunBullets;
-	health.healthPoints = status.healthPoints;
+	const auto player = *playerView.begin();
+	mRegistry.replace<component::Bullets>(player, status.numOfPistolBullets, status.numOfShotgunBullets);
+	mRegistry.replace<component::Health>(player, status.healthPoints, playerView.get<component::Health>(player).maxHealthPoints);
 }
 
 PlayerStatus Scene::getPlayerStatus()
@@ -121,8 +140,9 @@ PlayerStatus Scene::getPlayerStatus()
 void Scene::setPlayerPosition(sf::Vector2f newPosition)
 {
 	auto playerView = mRegistry.view<component::Player, component::BodyRect>();
-	auto& bodyRect = playerView.get<component::BodyRect>(*playerView.begin());
-	bodyRect.rect.setPosition(newPosition);
+	const auto player = *playerView.begin();
+	playerView.get<component::BodyRect>(player).rect.setPosition(newPosition);
+	system::BodyRectsSnapshot::skipInterpolation(mRegistry, player);
 }
 
 entt::registry& Scene::getRegistry()
@@ -21,6 +21,7 @@ public:
     void popScene();
     
 	void changingScenesProcess();
+	bool isChangingScene() const { return mIsReplacing || mIsPopping; }
 
 	bool hasPlayerPositionForNextScene() const;
 	const sf::Vector2f& getPlayerPositionForNextScene() const;
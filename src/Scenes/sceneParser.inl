@@ -81,8 +81,12 @@ inline void SceneParser<GuiParser, MapParser, ObjectsParser, AudioParser, EnttPa
 	::parseArcadeMode(const Xml& sceneLinksNode, SystemsQueue& systemsQueue, GUI& gui, AIManager& aiManager,
 	                  MusicPlayer& musicPlayer, EntitiesTemplateStorage& templateStorage)
 {
-	if(!sceneLinksNode.getChildren("arcadeMode").empty())
-		systemsQueue.appendSystem<system::ArcadeMode>(std::ref(gui), std::ref(aiManager), std::ref(musicPlayer), std::ref(templateStorage));
+	if(!sceneLinksNode.getChildren("arcadeMode").empty()) {
+		systemsQueue.appendFixedStepSystem<system::ArcadeMode>(std::ref(gui), std::ref(aiManager), std::ref(musicPlayer), std::ref(templateStorage));
+		// spawners are polled by ArcadeMode instead of being timers of TimerWheel, because they need state of the wave
+		// and zombies of all spawners are created in one batch, it's cheap since ArcadeMode is updated only every 6th step
+		systemsQueue.setUpdateInterval<system::ArcadeMode>(6);
+	}
 }
 
 template<typename GuiParser, typename MapParser, typename ObjectsParser, typename AudioParser, typename EnttParser>
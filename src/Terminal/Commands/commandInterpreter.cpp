@@ -9,7 +9,9 @@
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/itemComponents.hpp"
 #include "ECS/Systems/areasDebug.hpp"
+#include "ECS/Systems/bodyRectsSnapshot.hpp"
 #include "Renderer/MinorRenderers/lightRenderer.hpp"
+#include "Renderer/renderer.hpp"
 #include <entt/entt.hpp>
 
 namespace ph {
@@ -33,6 +35,9 @@ void CommandInterpreter::init()
 	mCommandsMap["view"] =						&CommandInterpreter::executeView;
 	mCommandsMap["gotoscene"] =					&CommandInterpreter::executeGotoScene;
 	mCommandsMap["light"] =						&CommandInterpreter::executeLight;
+	mCommandsMap["dynamicresolution"] =			&CommandInterpreter::executeDynamicResolution;
+	mCommandsMap["fpslimit"] =					&CommandInterpreter::executeFpsLimit;
+	mCommandsMap["backgroundsimulation"] =		&CommandInterpreter::executeBackgroundSimulation;
 	mCommandsMap["m"] =							&CommandInterpreter::executeMove;
 	mCommandsMap[""] =							&CommandInterpreter::executeInfoMessage;
 }
@@ -58,6 +63,25 @@ int CommandInterpreter::getArgumentPositionInCommand() const
 	return argumentPosition == std::string::npos ? mCommand.size() : argumentPosition;
 }
 
+std::string CommandInterpreter::getFirstArgument() const
+{
+	const size_t argumentStartPos = mCommand.find_first_not_of(' ', getArgumentPositionInCommand());
+	if(argumentStartPos == std::string::npos)
+		return std::string();
+	const size_t argumentEndPos = mCommand.find(' ', argumentStartPos);
+	return mCommand.substr(argumentStartPos, argumentEndPos - argumentStartPos);
+}
+
+std::optional<float> CommandInterpreter::getFirstArgumentAsNumber() const
+{
+	const std::string argument = getFirstArgument();
+	char* numberEnd = nullptr;
+	const float number = std::strtof(argument.c_str(), &numberEnd);
+	if(argument.empty() || *numberEnd != '\0')
+		return std::nullopt;
+	return number;
+}
+
 void CommandInterpreter::executeInfoMessage() const
 {
 	executeMessage("This is terminal. Enter 'help' to see available commands.", MessageType::INFO);
@@ -90,7 +114,7 @@ void CommandInterpreter::executeHelp() const
 		"SETVOLUME", "TELEPORT"
 	};
 	const std::vector<std::string> commandsList2{
-		"CURRENTPOS", "COLLISIONDEBUG", "SPAWN", "VIEW"
+		"CURRENTPOS", "COLLISIONDEBUG", "SPAWN", "VIEW", "DYNAMICRESOLUTION", "FPSLIMIT", "BACKGROUNDSIMULATION"
 	};
 
 	if (commandContains('2')){
@@ -130,9 +154,10 @@ void CommandInterpreter::executeTeleport() const
 		return;
 
 	auto view = mSceneRegistry->view<component::Player, component::BodyRect>();
-	view.each([newPosition](const component::Player player, component::BodyRect& body) {
+	view.each([this, newPosition](entt::entity player, const component::Player, component::BodyRect& body) {
 		body.rect.left = newPosition.x;
 		body.rect.top = newPosition.y;
+		system::BodyRectsSnapshot::skipInterpolation(*mSceneRegistry, player);
 	});
 }
 
@@ -145,9 +170,10 @@ void CommandInterpreter::executeMove() const
 		moveOffset = sf::Vector2f(0.f , moveOffset.y);
 
 	auto view = mSceneRegistry->view<component::Player, component::BodyRect>();
-	view.each([moveOffset](const component::Player, component::BodyRect& body) {
+	view.each([this, moveOffset](entt::entity player, const component::Player, component::BodyRect& body) {
 		body.rect.left += moveOffset.x;
 		body.rect.top += moveOffset.y;
+		system::BodyRectsSnapshot::skipInterpolation(*mSceneRegistry, player);
 	});
 }
 
@@ -157,10 +183,10 @@ void CommandInterpreter::executeGive() const
 	{
 		int numberOfItems = static_cast<int>(getVolumeFromCommand());
 		auto view = mSceneRegistry->view<component::Player, component::Bullets>();
-		view.each([numberOfItems](const component::Player, component::Bullets& bullets) {
-			bullets.numOfPistolBullets += numberOfItems;
-			bullets.numOfShotgunBullets += numberOfItems;
-		});
+		for(auto player : view) {
+			const auto& bullets = view.get<component::Bullets>(player);
+			mSceneRegistry->replace<component::Bullets>(player, bullets.numOfPistolBullets + numberOfItems, bullets.numOfShotgunBullets + numberOfItems);
+		}
 	}
 	else
 		executeMessage("Type of item is unknown!", MessageType::ERROR);
@@ -293,6 +319,49 @@ void CommandInterpreter::executeLight() const
 		lightDebug.drawLight = on;
 }
 
+void CommandInterpreter::executeDynamicResolution() const
+{
+	auto settings = Renderer::getDynamicResolutionSettings();
+	const std::string argument = getFirstArgument();
+	if(argument == "on")
+		settings.isActive = true;
+	else if(argument == "off")
+		settings.isActive = false;
+	else {
+		executeMessage("Incorrect argument! Argument has to be 'on' or 'off'", MessageType::ERROR);
+		return;
+	}
+	Renderer::setDynamicResolutionSettings(settings);
+}
+
+void CommandInterpreter::executeFpsLimit() const
+{
+	auto& frameLimiter = mGameData->getFrameLimiter();
+	if(getFirstArgument() == "off") {
+		frameLimiter.setMaxFrameRate(0);
+		return;
+	}
+
+	const auto maxFrameRate = getFirstArgumentAsNumber();
+	if(!maxFrameRate || *maxFrameRate < 1.f) {
+		executeMessage("Incorrect argument! Argument has to be a number of frames per second or 'off'", MessageType::ERROR);
+		return;
+	}
+	frameLimiter.setMaxFrameRate(static_cast<unsigned>(*maxFrameRate));
+}
+
+void CommandInterpreter::executeBackgroundSimulation() const
+{
+	auto& frameLimiter = mGameData->getFrameLimiter();
+	const std::string argument = getFirstArgument();
+	if(argument == "on")
+		frameLimiter.setSimulatesInBackground(true);
+	else if(argument == "off")
+		frameLimiter.setSimulatesInBackground(false);
+	else
+		executeMessage("Incorrect argument! Argument has to be 'on' or 'off'", MessageType::ERROR);
+}
+
 auto CommandInterpreter::getVector2Argument() const -> sf::Vector2f
 {
 	const std::string numbers("1234567890-");
@@ -3,6 +3,7 @@
 #include <string>
 #include <SFML/Graphics.hpp>
 #include <unordered_map>
+#include <optional>
 #include <entt/entt.hpp>
 
 namespace ph {
@@ -25,6 +26,8 @@ public:
 private:
 	std::string getCommandWithoutArguments() const;
 	int getArgumentPositionInCommand() const;
+	std::string getFirstArgument() const;
+	std::optional<float> getFirstArgumentAsNumber() const;
 
 	void executeInfoMessage() const;
 	void executeEcho() const;
@@ -54,6 +57,9 @@ private:
 	void executeView() const;
 
 	void executeLight() const;
+	void executeDynamicResolution() const;
+	void executeFpsLimit() const;
+	void executeBackgroundSimulation() const;
 
 	auto getVector2Argument() const -> sf::Vector2f;
 	sf::Vector2f handleGetVector2ArgumentError() const;
@@ -0,0 +1,30 @@
+#include "frameLimiter.hpp"
+#include <thread>
+
+namespace ph {
+
+void FrameLimiter::waitForNextFrame(bool isInBackground)
+{
+	const unsigned frameRate = isInBackground ? mBackgroundFrameRate : mMaxFrameRate;
+	const auto now = Clock::now();
+	if(frameRate == 0) {
+		mNextFrameTime = now;
+		return;
+	}
+
+	// frames are scheduled one after another, so sleeping longer than needed in one frame is made up in the next one,
+	// but when game is late more than one frame it doesn't try to catch up
+	const auto frameDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / frameRate));
+	mNextFrameTime += frameDuration;
+	if(mNextFrameTime < now - frameDuration)
+		mNextFrameTime = now;
+
+	// sleep is not precise, so the last millisecond is waited actively
+	constexpr auto sleepPrecision = std::chrono::milliseconds(1);
+	if(mNextFrameTime - now > sleepPrecision)
+		std::this_thread::sleep_until(mNextFrameTime - sleepPrecision);
+	while(Clock::now() < mNextFrameTime)
+		std::this_thread::yield();
+}
+
+}
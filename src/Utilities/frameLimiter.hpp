@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+
+namespace ph {
+
+// Limits frame rate by sleeping at the end of the frame, so it works also when vsync is off or ignored by the driver.
+// When window isn't focused game runs in background mode with low frame rate, so alt-tabbed game doesn't use a whole core.
+
+class FrameLimiter
+{
+public:
+	// 0 means that frame rate isn't limited
+	void setMaxFrameRate(unsigned framesPerSecond) { mMaxFrameRate = framesPerSecond; }
+	unsigned getMaxFrameRate() const { return mMaxFrameRate; }
+
+	void setBackgroundFrameRate(unsigned framesPerSecond) { mBackgroundFrameRate = framesPerSecond; }
+	unsigned getBackgroundFrameRate() const { return mBackgroundFrameRate; }
+
+	// by default scene is paused in background mode
+	void setSimulatesInBackground(bool simulates) { mSimulatesInBackground = simulates; }
+	bool simulatesInBackground() const { return mSimulatesInBackground; }
+
+	void waitForNextFrame(bool isInBackground);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	Clock::time_point mNextFrameTime = Clock::now();
+	unsigned mMaxFrameRate = 0;
+	unsigned mBackgroundFrameRate = 15;
+	bool mSimulatesInBackground = false;
+};
+
+}
@@ -0,0 +1,121 @@
+#include "jobSystem.hpp"
+
+namespace ph {
+
+namespace {
+	struct WorkerIdentity
+	{
+		const JobSystem* jobSystem = nullptr;
+		unsigned queueIndex = 0;
+	};
+
+	thread_local WorkerIdentity workerIdentityOfThisThread;
+}
+
+JobSystem::JobSystem(unsigned nrOfWorkers)
+{
+	for(unsigned i = 0; i < nrOfWorkers + 1; ++i)
+		mQueues.emplace_back(std::make_unique<JobQueue>());
+
+	mWorkers.reserve(nrOfWorkers);
+	for(unsigned i = 0; i < nrOfWorkers; ++i)
+		mWorkers.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+		mIsShuttingDown = true;
+	}
+	mJobPushed.notify_all();
+	for(auto& worker : mWorkers)
+		worker.join();
+}
+
+JobSystem& JobSystem::getInstance()
+{
+	static JobSystem instance([] {
+		unsigned hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 2 ? hardwareThreads - 2 : 0;
+	}());
+	return instance;
+}
+
+void JobSystem::push(std::function<void()> job)
+{
+	auto& queue = *mQueues[getQueueIndexOfThisThread()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.emplace_back(std::move(job));
+	}
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+		++mNrOfQueuedJobs;
+	}
+	mJobPushed.notify_one();
+}
+
+bool JobSystem::tryRunOneJob()
+{
+	const unsigned queueIndex = getQueueIndexOfThisThread();
+	std::function<void()> job;
+	if(tryPopOwnJob(queueIndex, job) || tryStealJob(queueIndex, job)) {
+		--mNrOfQueuedJobs;
+		job();
+		return true;
+	}
+	return false;
+}
+
+void JobSystem::workerLoop(unsigned queueIndex)
+{
+	workerIdentityOfThisThread = {this, queueIndex};
+
+	for(;;)
+	{
+		if(tryRunOneJob())
+			continue;
+
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		mJobPushed.wait(lock, [this] { return mIsShuttingDown || mNrOfQueuedJobs > 0; });
+		if(mIsShuttingDown && mNrOfQueuedJobs == 0)
+			return;
+	}
+}
+
+unsigned JobSystem::getQueueIndexOfThisThread() const
+{
+	if(workerIdentityOfThisThread.jobSystem == this)
+		return workerIdentityOfThisThread.queueIndex;
+	return static_cast<unsigned>(mQueues.size() - 1);
+}
+
+bool JobSystem::tryPopOwnJob(unsigned queueIndex, std::function<void()>& job)
+{
+	// the newest job is the most likely to have its data still in cache
+	auto& queue = *mQueues[queueIndex];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if(queue.jobs.empty())
+		return false;
+	job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	return true;
+}
+
+bool JobSystem::tryStealJob(unsigned thiefQueueIndex, std::function<void()>& job)
+{
+	for(size_t i = 1; i < mQueues.size(); ++i)
+	{
+		auto& queue = *mQueues[(thiefQueueIndex + i) % mQueues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if(!queue.jobs.empty()) {
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+}
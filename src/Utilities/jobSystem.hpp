@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace ph {
+
+// Every worker has its own queue of jobs. Worker takes the newest job from its own queue,
+// and when its queue is empty it steals the oldest job from the queue of another worker.
+// Threads which wait for jobs (for example in parallelFor()) execute other jobs in the meantime,
+// so jobs can push and wait for other jobs without blocking workers.
+
+class JobSystem
+{
+public:
+	explicit JobSystem(unsigned nrOfWorkers);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// job system used by the game, it leaves one hardware thread for main thread and one for render thread
+	static JobSystem& getInstance();
+
+	// job pushed by worker goes to its own queue, jobs pushed by other threads go to the shared queue
+	void push(std::function<void()> job);
+
+	// returns false if there was no job to execute
+	bool tryRunOneJob();
+
+	template<typename Predicate>
+	void helpUntil(Predicate isDone);
+
+	// splits [0, size) into chunks and calls function(begin, end) for every chunk, chunks are executed by many threads
+	// and the calling thread, function returns when all chunks are done
+	template<typename Function>
+	void parallelFor(size_t size, size_t minChunkSize, const Function& function);
+
+	unsigned getNrOfWorkers() const { return static_cast<unsigned>(mWorkers.size()); }
+
+private:
+	void workerLoop(unsigned queueIndex);
+	unsigned getQueueIndexOfThisThread() const;
+	bool tryPopOwnJob(unsigned queueIndex, std::function<void()>& job);
+	bool tryStealJob(unsigned thiefQueueIndex, std::function<void()>& job);
+
+private:
+	struct JobQueue
+	{
+		std::mutex mutex;
+		std::deque<std::function<void()>> jobs;
+	};
+
+	// queue of every worker and at the end the queue shared by threads which aren't workers
+	std::vector<std::unique_ptr<JobQueue>> mQueues;
+	std::vector<std::thread> mWorkers;
+	std::atomic<size_t> mNrOfQueuedJobs{0};
+	std::mutex mSleepMutex;
+	std::condition_variable mJobPushed;
+	bool mIsShuttingDown = false;
+};
+
+}
+
+#include "jobSystem.inl"
@@ -0,0 +1,52 @@
+#include <exception>
+#include <algorithm>
+
+namespace ph {
+
+template<typename Predicate>
+void JobSystem::helpUntil(Predicate isDone)
+{
+	while(!isDone())
+		if(!tryRunOneJob())
+			std::this_thread::yield();
+}
+
+template<typename Function>
+void JobSystem::parallelFor(size_t size, size_t minChunkSize, const Function& function)
+{
+	// a few chunks per thread, so threads which finished earlier can steal the rest
+	const size_t maxNrOfChunks = (mWorkers.size() + 1) * 4;
+	const size_t nrOfChunks = std::min(maxNrOfChunks, (size + minChunkSize - 1) / std::max<size_t>(minChunkSize, 1));
+	if(nrOfChunks <= 1 || mWorkers.empty()) {
+		function(size_t(0), size);
+		return;
+	}
+
+	const size_t chunkSize = (size + nrOfChunks - 1) / nrOfChunks;
+	std::atomic<size_t> nrOfRemainingChunks{nrOfChunks};
+	std::exception_ptr exception;
+	std::mutex exceptionMutex;
+
+	auto runChunk = [&](size_t begin) {
+		try {
+			function(begin, std::min(begin + chunkSize, size));
+		}
+		catch(...) {
+			std::lock_guard<std::mutex> lock(exceptionMutex);
+			if(!exception)
+				exception = std::current_exception();
+		}
+		--nrOfRemainingChunks;
+	};
+
+	for(size_t begin = chunkSize; begin < size; begin += chunkSize)
+		push([&runChunk, begin] { runChunk(begin); });
+	runChunk(0);
+
+	helpUntil([&nrOfRemainingChunks] { return nrOfRemainingChunks == 0; });
+
+	if(exception)
+		std::rethrow_exception(exception);
+}
+
+}
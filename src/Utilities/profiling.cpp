@@ -12,6 +12,7 @@ ProfilingManager::ProfilingManager()
 
 void ProfilingManager::beginSession(const std::string& name, const std::string& filepath)
 {
+	std::lock_guard<std::mutex> lock(mMutex);
 	mOutputStream.open(filepath);
 	writeHeader();
 	mIsThereActiveSession = true;
@@ -19,6 +20,7 @@ void ProfilingManager::beginSession(const std::string& name, const std::string&
 
 void ProfilingManager::endSession()
 {
+	std::lock_guard<std::mutex> lock(mMutex);
 	writeFooter();
 	mOutputStream.close();
 	mIsThereActiveSession = false;
@@ -27,15 +29,16 @@ void ProfilingManager::endSession()
 
 void ProfilingManager::writeProfile(const ProfilingResult& result)
 {
+	std::string name = result.name;
+	std::replace(name.begin(), name.end(), '"', '\'');
+
+	std::lock_guard<std::mutex> lock(mMutex);
 	if(!mIsThereActiveSession)
 		return;
 
 	if(mProfileCount++ > 0)
 		mOutputStream << ",";
 
-	std::string name = result.name;
-	std::replace(name.begin(), name.end(), '"', '\'');
-
 	mOutputStream << "{";
 	mOutputStream << "\"cat\":\"function\",";
 	mOutputStream << "\"dur\":" << (result.end - result.start) << ',';
@@ -47,6 +50,27 @@ void ProfilingManager::writeProfile(const ProfilingResult& result)
 	mOutputStream << "}";
 }
 
+void ProfilingManager::writeCounter(const char* name, long long value)
+{
+	long long timestamp = std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()).time_since_epoch().count();
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if(!mIsThereActiveSession)
+		return;
+
+	if(mProfileCount++ > 0)
+		mOutputStream << ",";
+
+	mOutputStream << "{";
+	mOutputStream << "\"cat\":\"counter\",";
+	mOutputStream << "\"name\":\"" << name << "\",";
+	mOutputStream << "\"ph\":\"C\",";
+	mOutputStream << "\"pid\":0,";
+	mOutputStream << "\"ts\":" << timestamp << ",";
+	mOutputStream << "\"args\":{\"value\":" << value << "}";
+	mOutputStream << "}";
+}
+
 void ProfilingManager::writeHeader()
 {
 	mOutputStream << "{\"otherData\": {},\"traceEvents\":[";
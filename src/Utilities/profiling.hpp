@@ -3,6 +3,7 @@
 #include <string>
 #include <chrono>
 #include <fstream>
+#include <mutex>
 
 namespace ph {
 
@@ -31,10 +32,14 @@ public:
 	void endSession();
 
 	void writeProfile(const ProfilingResult& result);
+	// counters are shown as graphs over the time in chrome://tracing
+	void writeCounter(const char* name, long long value);
 	void writeHeader();
 	void writeFooter();
 
 private:
+	// systems are updated on many threads and all of them write to the same stream
+	std::mutex mMutex;
 	std::ofstream mOutputStream;
 	int mProfileCount;
 	bool mIsThereActiveSession;
@@ -65,9 +70,11 @@ private:
 	#define PH_END_PROFILING_SESSION() ph::ProfilingManager::getInstance().endSession()
 	#define PH_PROFILE_SCOPE(name) ph::ProfilingTimer profTimer##__LINE__(name);
 	#define PH_PROFILE_FUNCTION() PH_PROFILE_SCOPE(__FUNCTION__);
+	#define PH_PROFILE_COUNTER(name, value) ph::ProfilingManager::getInstance().writeCounter(name, static_cast<long long>(value));
 #else
 	#define PH_BEGIN_PROFILING_SESSION(name, filepath)
 	#define PH_END_PROFILING_SESSION()
 	#define PH_PROFILE_SCOPE(name)
 	#define PH_PROFILE_FUNCTION()
+	#define PH_PROFILE_COUNTER(name, value)
 #endif
@@ -2,10 +2,13 @@
 #include "Logs/logs.hpp"
 #include <random>
 #include <ctime>
+#include <thread>
 
 namespace ph::Random {
 
-static std::default_random_engine engine = std::default_random_engine(static_cast<unsigned>(time(nullptr)));
+// every thread has its own engine, so random numbers can be generated by systems updated in parallel
+static thread_local std::default_random_engine engine = std::default_random_engine(
+	static_cast<unsigned>(time(nullptr)) ^ static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id())));
 
 float generateNumber(const float min, const float max)
 {
@@ -0,0 +1,60 @@
+#include "rectsMerging.hpp"
+#include <algorithm>
+#include <tuple>
+
+namespace ph {
+
+namespace {
+
+enum class Axis { x, y };
+
+float getStart(const FloatRect& rect, Axis axis) { return axis == Axis::x ? rect.left : rect.top; }
+float getSize(const FloatRect& rect, Axis axis) { return axis == Axis::x ? rect.width : rect.height; }
+float getEnd(const FloatRect& rect, Axis axis) { return getStart(rect, axis) + getSize(rect, axis); }
+
+void setEnd(FloatRect& rect, Axis axis, float end)
+{
+	if(axis == Axis::x)
+		rect.width = end - rect.left;
+	else
+		rect.height = end - rect.top;
+}
+
+// rects with the same start and size across given axis which touch or overlap along it become one rect
+void mergeRuns(std::vector<FloatRect>& rects, Axis along)
+{
+	const Axis across = along == Axis::x ? Axis::y : Axis::x;
+	auto getSortKey = [along, across](const FloatRect& rect) {
+		return std::make_tuple(getStart(rect, across), getSize(rect, across), getStart(rect, along));
+	};
+	std::sort(rects.begin(), rects.end(), [&getSortKey](const FloatRect& a, const FloatRect& b) {
+		return getSortKey(a) < getSortKey(b);
+	});
+
+	std::vector<FloatRect> merged;
+	for(const FloatRect& rect : rects)
+	{
+		if(!merged.empty())
+		{
+			FloatRect& last = merged.back();
+			const bool isInTheSameRun = getStart(last, across) == getStart(rect, across) && getSize(last, across) == getSize(rect, across);
+			if(isInTheSameRun && getStart(rect, along) <= getEnd(last, along))
+			{
+				setEnd(last, along, std::max(getEnd(last, along), getEnd(rect, along)));
+				continue;
+			}
+		}
+		merged.emplace_back(rect);
+	}
+	rects = std::move(merged);
+}
+
+}
+
+void mergeAdjacentRects(std::vector<FloatRect>& rects)
+{
+	mergeRuns(rects, Axis::x);
+	mergeRuns(rects, Axis::y);
+}
+
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Utilities/rect.hpp"
+#include <vector>
+
+namespace ph {
+
+// Greedily merges rects into bigger ones without changing the area they cover.
+// First rects with the same top and height which touch or overlap become one row,
+// then rows with the same left and width which touch or overlap become one rect.
+// It's meant for load time, for example grid of tiles becomes a few rects.
+void mergeAdjacentRects(std::vector<FloatRect>& rects);
+
+}
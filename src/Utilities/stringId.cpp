@@ -0,0 +1,48 @@
+#include "stringId.hpp"
+#include "Logs/logs.hpp"
+#include <mutex>
+#include <unordered_map>
+
+namespace ph {
+
+#ifndef PH_DISTRIBUTION
+
+namespace {
+	// strings are parsed mostly on the main thread, but systems updated in parallel can show them in logs
+	std::mutex internedStringsMutex;
+	std::unordered_map<std::uint32_t, std::string> internedStrings;
+}
+
+StringId StringId::intern(std::string_view string)
+{
+	const StringId stringId(string);
+
+	std::lock_guard<std::mutex> lock(internedStringsMutex);
+	const auto [interned, wasInserted] = internedStrings.emplace(stringId.mId, string);
+	PH_ASSERT_CRITICAL(wasInserted || interned->second == string,
+		"StringId of \"" + std::string(string) + "\" is the same as StringId of \"" + interned->second + "\"!");
+	return stringId;
+}
+
+const char* StringId::getString() const
+{
+	std::lock_guard<std::mutex> lock(internedStringsMutex);
+	auto found = internedStrings.find(mId);
+	return found != internedStrings.end() ? found->second.c_str() : "<not interned>";
+}
+
+#else
+
+StringId StringId::intern(std::string_view string)
+{
+	return StringId(string);
+}
+
+const char* StringId::getString() const
+{
+	return "<not interned>";
+}
+
+#endif
+
+}
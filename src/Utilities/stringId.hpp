@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace ph {
+
+// 32 bit hash (FNV-1a) of a string, which is copied, compared and hashed instead of the string.
+// Id of string literal is computed at compile time when it's used in constant expression.
+//
+// Strings read from files are interned with StringId::intern() when files are parsed. In builds other than
+// distribution interning remembers the string, so getString() can show it in logs and debugger,
+// and asserts that two different strings don't have the same id.
+
+class StringId
+{
+public:
+	constexpr StringId() = default;
+	constexpr StringId(const char* string) : mId(hash(string)) {}
+	constexpr StringId(std::string_view string) : mId(hash(string)) {}
+	StringId(const std::string& string) : mId(hash(string)) {}
+
+	static StringId intern(std::string_view string);
+
+	// returns "<not interned>" for strings which weren't interned and for all strings in distribution build
+	const char* getString() const;
+
+	constexpr std::uint32_t getId() const { return mId; }
+
+	constexpr bool operator==(StringId other) const { return mId == other.mId; }
+	constexpr bool operator!=(StringId other) const { return mId != other.mId; }
+	constexpr bool operator<(StringId other) const { return mId < other.mId; }
+
+private:
+	static constexpr std::uint32_t hash(std::string_view string)
+	{
+		std::uint32_t hash = 2166136261u;
+		for(char c : string)
+			hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+		return hash;
+	}
+
+private:
+	// id of empty string
+	std::uint32_t mId = 2166136261u;
+};
+
+}
+
+namespace std {
+
+template<>
+struct hash<ph::StringId>
+{
+	size_t operator()(ph::StringId stringId) const noexcept { return stringId.getId(); }
+};
+
+}
@@ -50,6 +50,10 @@ Game::Game()
 	mWindow.setKeyRepeatEnabled(false);
 
 	ActionEventManager::init();
+
+#if PH_RENDER_THREAD
+	Renderer::startRenderThread(mWindow);
+#endif
 }
 
 void Game::run()
@@ -57,10 +61,18 @@ void Game::run()
 	sf::Clock clock;
 	while(mGameData->getGameCloser().shouldGameBeClosed() == false)
 	{
-		mSceneManager->changingScenesProcess();
+		if(mSceneManager->isChangingScene())
+		{
+			Renderer::acquireGLContextOnMainThread();
+			mSceneManager->changingScenesProcess();
+			Renderer::releaseGLContextFromMainThread();
+		}
 		handleEvents();
 		const sf::Time dt = clock.restart();
 		update(correctDeltaTime(dt));
+
+		// unfocused or minimized game runs in background mode with low frame rate
+		mGameData->getFrameLimiter().waitForNextFrame(!mWindow.hasFocus());
 	}
 
 	Renderer::shutDown();
@@ -69,7 +81,9 @@ void Game::run()
 
 sf::Time Game::correctDeltaTime(sf::Time dt)
 {
-	const sf::Time dtMinimalConstrain = sf::seconds(1.f/20.f);
+	// scene systems catch up with slow frames by themselves (see SystemsQueue::setMaxNrOfFixedStepsPerFrame),
+	// this only protects from huge dt after e.g. loading of the scene
+	const sf::Time dtMinimalConstrain = sf::seconds(1.f/4.f);
 	return dt > dtMinimalConstrain ? dtMinimalConstrain : dt;
 }
 
@@ -82,7 +96,7 @@ void Game::handleEvents()
 			if (event->type == sf::Event::Closed)
 				mGameData->getGameCloser().closeGame();
 
-		handleGlobalKeyboardShortcuts(mGameData->getWindow(), mGameData->getGameCloser(), phEvent);
+		handleGlobalKeyboardShortcuts(mWindow, mGameData->getGameCloser(), phEvent);
 		mDebugCounter->handleEvent(phEvent);
 		mTerminal->handleEvent(phEvent);
 		mGui->handleEvent(phEvent);
@@ -100,7 +114,7 @@ void Game::update(sf::Time dt)
 {
 	mDebugCounter->update();
 
-	if(mWindow.hasFocus())
+	if(mWindow.hasFocus() || mGameData->getFrameLimiter().simulatesInBackground())
 	{
 		mSceneManager->update(dt);
 		mAIManager->update();
@@ -109,7 +123,6 @@ void Game::update(sf::Time dt)
 		mTerminal->update();
 
 		Renderer::endScene(mWindow, *mDebugCounter);
-		mWindow.display();
 	}
 }
 
@@ -7,6 +7,7 @@
 #include "Resources/resourceHolder.hpp"
 #include "Terminal/terminal.hpp"
 #include "GUI/gui.hpp"
+#include "Utilities/frameLimiter.hpp"
 #include <SFML/Window/Window.hpp>
 #include <memory>
 
@@ -52,6 +53,7 @@ public:
 		,mTerminal{Terminal}
 		,mGui(Gui)
 		,mGameCloser()
+		,mFrameLimiter()
 	{
 	}
 	
@@ -65,6 +67,7 @@ public:
 	auto getTerminal() const -> Terminal& { return *mTerminal; }
 	auto getGui() const -> GUI& { return *mGui; }
 	auto getGameCloser() -> GameCloser& { return mGameCloser; }
+	auto getFrameLimiter() -> FrameLimiter& { return mFrameLimiter; }
 
 private:
 	sf::Window* const mWindow;
@@ -77,6 +80,7 @@ private:
 	Terminal* const mTerminal;
 	GUI* const mGui;
 	GameCloser mGameCloser;
+	FrameLimiter mFrameLimiter;
 };
 
 }
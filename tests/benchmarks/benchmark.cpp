@@ -0,0 +1,43 @@
+#include "benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace ph::Benchmarks {
+
+auto getRegisteredBenchmarks() -> std::vector<Benchmark>&
+{
+	static std::vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+void measure(const char* name, size_t nrOfItemsPerRun, const char* itemName,
+             const std::function<void()>& run, const std::function<void()>& setUp)
+{
+	using Clock = std::chrono::steady_clock;
+	constexpr size_t minNrOfRuns = 10;
+	constexpr size_t maxNrOfRuns = 1000;
+	const auto minDuration = std::chrono::milliseconds(500);
+
+	// warm up caches and allocations
+	setUp();
+	run();
+
+	std::vector<double> runTimesInNs;
+	const auto start = Clock::now();
+	while(runTimesInNs.size() < maxNrOfRuns && (runTimesInNs.size() < minNrOfRuns || Clock::now() - start < minDuration))
+	{
+		setUp();
+		const auto runStart = Clock::now();
+		run();
+		const auto runEnd = Clock::now();
+		runTimesInNs.emplace_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(runEnd - runStart).count()));
+	}
+
+	std::sort(runTimesInNs.begin(), runTimesInNs.end());
+	const double median = runTimesInNs[runTimesInNs.size() / 2];
+	std::printf("  %-45s %10.2f ns/%s  (%.3f ms/run, %zu runs)\n",
+		name, median / nrOfItemsPerRun, itemName, median / 1e6, runTimesInNs.size());
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace ph::Benchmarks {
+
+struct Benchmark
+{
+	const char* name;
+	void(*function)();
+};
+
+auto getRegisteredBenchmarks() -> std::vector<Benchmark>&;
+
+struct BenchmarkRegistration
+{
+	BenchmarkRegistration(const char* name, void(*function)()) { getRegisteredBenchmarks().push_back({name, function}); }
+};
+
+// calls setUp and run many times and prints median time of run per one processed item
+void measure(const char* name, size_t nrOfItemsPerRun, const char* itemName,
+             const std::function<void()>& run, const std::function<void()>& setUp = []{});
+
+}
+
+#define PH_BENCHMARK(benchmarkName) \
+	static void benchmarkName(); \
+	static ph::Benchmarks::BenchmarkRegistration benchmarkName##Registration(#benchmarkName, &benchmarkName); \
+	static void benchmarkName()
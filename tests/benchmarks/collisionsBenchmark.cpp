@@ -0,0 +1,79 @@
+#include "benchmark.hpp"
+#include "ECS/sweepAndPrune.hpp"
+#include <entt/entity/registry.hpp>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares pair loop which KinematicCollisions used before with sweep and prune on moving bodies.
+// Density of bodies is the same for every count, like zombies which fill bigger area in bigger waves.
+
+namespace ph {
+
+namespace {
+	struct MovingBody
+	{
+		entt::entity entity;
+		FloatRect rect;
+		sf::Vector2f velocity;
+	};
+
+	std::vector<MovingBody> createBodies(size_t nrOfBodies)
+	{
+		std::mt19937 engine(7);
+		const float areaSize = 40.f * std::sqrt(static_cast<float>(nrOfBodies));
+		std::uniform_real_distribution<float> position(0.f, areaSize);
+		std::uniform_real_distribution<float> speed(-1.f, 1.f);
+
+		std::vector<MovingBody> bodies;
+		for(size_t i = 0; i < nrOfBodies; ++i)
+			bodies.push_back({static_cast<entt::entity>(i), FloatRect(position(engine), position(engine), 20.f, 20.f),
+			                  sf::Vector2f(speed(engine), speed(engine))});
+		return bodies;
+	}
+
+	size_t countOverlappingPairs(const std::vector<MovingBody>& bodies)
+	{
+		size_t nrOfPairs = 0;
+		for(size_t i = 0; i < bodies.size(); ++i)
+			for(size_t j = i + 1; j < bodies.size(); ++j)
+				if(bodies[i].rect.doPositiveRectsIntersect(bodies[j].rect))
+					++nrOfPairs;
+		return nrOfPairs;
+	}
+
+	void moveBodies(std::vector<MovingBody>& bodies)
+	{
+		for(auto& body : bodies)
+			body.rect.move(body.velocity);
+	}
+}
+
+PH_BENCHMARK(kinematicCollisionsBroadPhase)
+{
+	for(size_t nrOfBodies : {100, 1000, 10000})
+	{
+		auto bodies = createBodies(nrOfBodies);
+		size_t nrOfPairs = 0;
+
+		const std::string pairLoopName = "pair loop, " + std::to_string(nrOfBodies) + " bodies";
+		Benchmarks::measure(pairLoopName.c_str(), nrOfBodies, "body", [&] {
+			nrOfPairs = countOverlappingPairs(bodies);
+		}, [&] { moveBodies(bodies); });
+
+		SweepAndPrune sweepAndPrune;
+		const std::string sweepAndPruneName = "sweep and prune, " + std::to_string(nrOfBodies) + " bodies";
+		Benchmarks::measure(sweepAndPruneName.c_str(), nrOfBodies, "body", [&] {
+			for(const auto& body : bodies)
+				sweepAndPrune.setBody(body.entity, body.rect);
+			sweepAndPrune.update();
+		}, [&] { moveBodies(bodies); });
+
+		nrOfPairs = countOverlappingPairs(bodies);
+		std::printf("  %zu overlapping pairs, %zu found by sweep and prune\n", nrOfPairs, sweepAndPrune.getOverlappingPairs().size());
+	}
+}
+
+}
@@ -0,0 +1,92 @@
+#include "benchmark.hpp"
+#include "ECS/parallelForEach.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/objectsComponents.hpp"
+#include "ECS/Components/animationComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+#include <entt/entity/registry.hpp>
+#include <cstdio>
+
+// Compares view.each() loops which systems used before with parallelForEach() on the same workloads.
+
+namespace ph {
+
+namespace {
+	constexpr size_t nrOfEntities = 100000;
+
+	void updateCar(float dt, component::Car& car, component::BodyRect& body)
+	{
+		if(car.shouldSpeedUp)
+			car.velocity += car.acceleration * dt;
+		if(car.shouldSlowDown)
+			car.velocity -= car.slowingDown * dt;
+		car.velocity -= 0.1f * dt;
+		if(car.velocity < 1.f)
+			car.velocity = 0.f;
+		body.rect.move(car.direction * car.velocity * dt);
+	}
+
+	void updateAnimation(float dt, component::AnimationData& animationData, component::TextureRect& textureRect)
+	{
+		animationData.elapsedTime += dt;
+		while(animationData.elapsedTime >= animationData.delay)
+		{
+			animationData.elapsedTime -= animationData.delay;
+			StateData& state = animationData.states->at(animationData.currentStateName);
+			if(++animationData.currentFrameIndex >= state.frameCount)
+				animationData.currentFrameIndex = 0;
+			textureRect.rect = IntRect(state.startFrame.left + state.startFrame.width * animationData.currentFrameIndex,
+			                           state.startFrame.top, state.startFrame.width, state.startFrame.height);
+		}
+	}
+}
+
+PH_BENCHMARK(parallelForEach)
+{
+	std::printf("  %u workers in job system\n", JobSystem::getInstance().getNrOfWorkers());
+
+	entt::registry registry;
+	AnimationStatesData states;
+	states["walk"] = StateData{IntRect(0, 0, 16, 16), 8};
+	for(size_t i = 0; i < nrOfEntities; ++i)
+	{
+		auto entity = registry.create();
+		const float position = static_cast<float>(i);
+		registry.assign<component::BodyRect>(entity, FloatRect(position, position, 16.f, 16.f));
+		registry.assign<component::Velocity>(entity, float(i % 13), float(i % 7));
+		if(i % 10 != 0)
+			registry.assign<component::PushingForces>(entity);
+		registry.assign<component::Car>(entity, component::Car{sf::Vector2f(1.f, 0.f), 10.f, 2.f, 1.f, i % 2 == 0, i % 3 == 0});
+		registry.assign<component::AnimationData>(entity, component::AnimationData{"walk", &states, 0.01f, 0.f, 0, true});
+		registry.assign<component::TextureRect>(entity);
+	}
+
+	const float dt = 0.016f;
+	auto bodies = registry.view<component::BodyRect, component::Velocity>(entt::exclude<component::PushingForces>);
+	auto moveBody = [dt](component::BodyRect& body, const component::Velocity& vel) {
+		body.rect.left += vel.dx * dt;
+		body.rect.top  += vel.dy * dt;
+	};
+	Benchmarks::measure("movement, each", bodies.size(), "entity", [&] { bodies.each(moveBody); });
+	Benchmarks::measure("movement, parallelForEach", bodies.size(), "entity", [&] {
+		parallelForEach<component::BodyRect, component::Velocity>(registry, moveBody, entt::exclude<component::PushingForces>);
+	});
+
+	auto cars = registry.view<component::Car, component::BodyRect>();
+	auto moveCar = [dt](component::Car& car, component::BodyRect& body) { updateCar(dt, car, body); };
+	Benchmarks::measure("cars, each", nrOfEntities, "entity", [&] { cars.each(moveCar); });
+	Benchmarks::measure("cars, parallelForEach", nrOfEntities, "entity", [&] {
+		parallelForEach<component::Car, component::BodyRect>(registry, moveCar);
+	});
+
+	auto animations = registry.view<component::AnimationData, component::TextureRect>();
+	auto animate = [dt](component::AnimationData& animationData, component::TextureRect& textureRect) {
+		updateAnimation(dt, animationData, textureRect);
+	};
+	Benchmarks::measure("animation, each", nrOfEntities, "entity", [&] { animations.each(animate); });
+	Benchmarks::measure("animation, parallelForEach", nrOfEntities, "entity", [&] {
+		parallelForEach<component::AnimationData, component::TextureRect>(registry, animate);
+	});
+}
+
+}
@@ -0,0 +1,92 @@
+#include "benchmark.hpp"
+#include "ECS/registryGroups.hpp"
+#include <entt/entity/registry.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares views which Movement, KinematicCollisions and RenderSystem used before with groups from registryGroups.hpp.
+// Besides zombies of arcade wave scene has two times more static objects, which have BodyRect and RenderQuad but don't move.
+// Zombies are pooled and reused, so their components are assigned in random order like in a scene played for a while.
+
+namespace ph {
+
+namespace {
+	void createScene(entt::registry& registry, size_t nrOfZombies)
+	{
+		std::mt19937 engine(7);
+		std::vector<entt::entity> zombies(nrOfZombies);
+		registry.create(zombies.begin(), zombies.end());
+		std::vector<entt::entity> staticObjects(nrOfZombies * 2);
+		registry.create(staticObjects.begin(), staticObjects.end());
+
+		auto assignInRandomOrder = [&](auto function) {
+			std::shuffle(zombies.begin(), zombies.end(), engine);
+			for(auto zombie : zombies)
+				function(zombie);
+		};
+		assignInRandomOrder([&](entt::entity zombie) {
+			registry.assign<component::BodyRect>(zombie, FloatRect(float(entt::to_integer(zombie) % 640), 0.f, 20.f, 20.f));
+		});
+		for(auto staticObject : staticObjects)
+			registry.assign<component::BodyRect>(staticObject, FloatRect(0.f, 0.f, 40.f, 40.f));
+		assignInRandomOrder([&](entt::entity zombie) { registry.assign<component::Velocity>(zombie, 1.f, -1.f); });
+		assignInRandomOrder([&](entt::entity zombie) { registry.assign<component::KinematicCollisionBody>(zombie, 5.f); });
+		assignInRandomOrder([&](entt::entity zombie) { registry.assign<component::RenderQuad>(zombie); });
+		for(auto staticObject : staticObjects)
+			registry.assign<component::RenderQuad>(staticObject);
+	}
+
+	void moveBody(component::BodyRect& body, const component::Velocity& vel)
+	{
+		body.rect.left += vel.dx * 0.016f;
+		body.rect.top  += vel.dy * 0.016f;
+	}
+}
+
+PH_BENCHMARK(registryGroups)
+{
+	for(size_t nrOfZombies : {100, 1000, 10000})
+	{
+		entt::registry viewRegistry;
+		createScene(viewRegistry, nrOfZombies);
+		entt::registry groupRegistry;
+		Groups::createGroups(groupRegistry);
+		createScene(groupRegistry, nrOfZombies);
+		const std::string zombies = ", " + std::to_string(nrOfZombies) + " zombies";
+		float sum = 0.f;
+
+		auto movingBodiesView = viewRegistry.view<component::BodyRect, component::Velocity>(entt::exclude<component::Sleeping>);
+		Benchmarks::measure(("moving bodies, view" + zombies).c_str(), nrOfZombies, "entity", [&] { movingBodiesView.each(moveBody); });
+		auto movingBodiesGroup = Groups::movingBodies(groupRegistry);
+		Benchmarks::measure(("moving bodies, group" + zombies).c_str(), nrOfZombies, "entity", [&] { movingBodiesGroup.each(moveBody); });
+
+		auto kinematicBodiesView = viewRegistry.view<component::BodyRect, component::Velocity, component::KinematicCollisionBody>(entt::exclude<component::Sleeping>);
+		Benchmarks::measure(("kinematic bodies, view" + zombies).c_str(), nrOfZombies, "entity", [&] {
+			kinematicBodiesView.each([&](const component::BodyRect& body, const component::Velocity& vel, const component::KinematicCollisionBody& kinematicBody) {
+				sum += body.rect.left + vel.dx + kinematicBody.mass;
+			});
+		});
+		auto kinematicBodiesGroup = Groups::kinematicBodies(groupRegistry);
+		Benchmarks::measure(("kinematic bodies, group" + zombies).c_str(), nrOfZombies, "entity", [&] {
+			kinematicBodiesGroup.each([&](const component::BodyRect& body, const component::Velocity& vel, const component::KinematicCollisionBody& kinematicBody) {
+				sum += body.rect.left + vel.dx + kinematicBody.mass;
+			});
+		});
+
+		auto renderQuadsView = viewRegistry.view<component::RenderQuad, component::BodyRect>(entt::exclude<component::HiddenForRenderer>);
+		Benchmarks::measure(("render quads, view" + zombies).c_str(), nrOfZombies * 3, "entity", [&] {
+			renderQuadsView.each([&](const component::RenderQuad& quad, const component::BodyRect& body) { sum += body.rect.top + quad.rotation; });
+		});
+		auto renderQuadsGroup = Groups::renderQuads(groupRegistry);
+		Benchmarks::measure(("render quads, group" + zombies).c_str(), nrOfZombies * 3, "entity", [&] {
+			renderQuadsGroup.each([&](const component::RenderQuad& quad, const component::BodyRect& body) { sum += body.rect.top + quad.rotation; });
+		});
+
+		std::printf("  checksum %f\n", sum);
+	}
+}
+
+}
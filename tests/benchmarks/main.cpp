@@ -0,0 +1,19 @@
+#include "benchmark.hpp"
+#include <cstdio>
+#include <cstring>
+
+// usage: Benchmarks [part of benchmark name]
+// benchmarks have to be run from the root directory of the repository because they load resources
+
+int main(int argc, char** argv)
+{
+	const char* filter = argc > 1 ? argv[1] : nullptr;
+	for(auto& benchmark : ph::Benchmarks::getRegisteredBenchmarks())
+	{
+		if(filter && !std::strstr(benchmark.name, filter))
+			continue;
+		std::printf("%s\n", benchmark.name);
+		benchmark.function();
+	}
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include "benchmark.hpp"
+#include "ECS/particleArena.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Compares vectors of particles of every emitter which PatricleSystem used before with ParticleArena.
+// Emitters are full like flowing rivers in the middle of the game, every frame the oldest particles die and the same number is spawned.
+// Both versions write quads of particles instead of submitting them to renderer.
+
+namespace ph {
+
+namespace {
+	struct Particle
+	{
+		sf::Vector2f position;
+		sf::Vector2f velocity;
+		float lifetime = 0.f;
+	};
+
+	constexpr float dt = 1.f / 60.f;
+	constexpr float wholeLifetime = 1.f;
+	const Vector4f startColor{1.f, 1.f, 1.f, 1.f};
+	const Vector4f endColor{0.f, 0.f, 1.f, 0.f};
+
+	void updateVectorOfParticles(std::vector<Particle>& particles, unsigned amountOfParticles, std::vector<QuadData>& quads)
+	{
+		while(!particles.empty() && particles.front().lifetime >= wholeLifetime)
+			particles.erase(particles.begin());
+		while(particles.size() < amountOfParticles)
+			particles.push_back({{0.f, 0.f}, {10.f, 20.f}, 0.f});
+
+		for(auto& particle : particles)
+		{
+			particle.lifetime += dt;
+			particle.velocity += sf::Vector2f(0.f, 1.f) * dt;
+			particle.position += particle.velocity * dt;
+
+			const float startColorMultiplier = (wholeLifetime - particle.lifetime) / wholeLifetime;
+			const float endColorMultiplier = particle.lifetime / wholeLifetime;
+			QuadData quad;
+			quad.color = {startColor.x * startColorMultiplier + endColor.x * endColorMultiplier,
+			              startColor.y * startColorMultiplier + endColor.y * endColorMultiplier,
+			              startColor.z * startColorMultiplier + endColor.z * endColorMultiplier,
+			              startColor.w * startColorMultiplier + endColor.w * endColorMultiplier};
+			quad.textureRect = FloatRect(0.f, 0.f, 1.f, 1.f);
+			quad.position = particle.position;
+			quad.size = {1.f, 1.f};
+			quad.rotationOrigin = {0.f, 0.f};
+			quad.rotation = 0.f;
+			quads.emplace_back(quad);
+		}
+	}
+
+	void updateRangeOfArena(ParticleArena& arena, ParticleArena::RangeId range, unsigned amountOfParticles, std::vector<QuadData>& quads)
+	{
+		arena.killOldParticles(range, wholeLifetime);
+		while(arena.getNrOfParticles(range) < amountOfParticles)
+			arena.spawn(range, {0.f, 0.f}, {10.f, 20.f});
+		arena.update(range, dt, {0.f, 1.f}, startColor, endColor, wholeLifetime);
+		arena.appendQuads(range, {0.f, 0.f}, {1.f, 1.f}, quads);
+	}
+}
+
+PH_BENCHMARK(particles)
+{
+	constexpr size_t nrOfEmitters = 20;
+	for(unsigned amountOfParticles : {60, 600, 3000})
+	{
+		const std::string particles = ", " + std::to_string(nrOfEmitters) + " emitters of " + std::to_string(amountOfParticles) + " particles";
+		const size_t nrOfParticles = nrOfEmitters * amountOfParticles;
+		std::vector<QuadData> quads;
+		quads.reserve(nrOfParticles);
+		float sum = 0.f;
+
+		// particles of emitters are spawned at different frames, so emitters don't kill all particles at once
+		std::vector<std::vector<Particle>> emitters(nrOfEmitters);
+		for(size_t i = 0; i < nrOfEmitters; ++i)
+			for(size_t frame = 0; frame < 60 + i; ++frame) {
+				quads.clear();
+				updateVectorOfParticles(emitters[i], amountOfParticles, quads);
+			}
+		Benchmarks::measure(("vectors of particles" + particles).c_str(), nrOfParticles, "particle", [&] {
+			quads.clear();
+			for(auto& emitter : emitters)
+				updateVectorOfParticles(emitter, amountOfParticles, quads);
+			sum += quads.back().position.y;
+		});
+
+		ParticleArena arena;
+		std::vector<ParticleArena::RangeId> ranges(nrOfEmitters);
+		for(size_t i = 0; i < nrOfEmitters; ++i) {
+			ranges[i] = arena.allocateRange(amountOfParticles);
+			for(size_t frame = 0; frame < 60 + i; ++frame) {
+				quads.clear();
+				updateRangeOfArena(arena, ranges[i], amountOfParticles, quads);
+			}
+		}
+		Benchmarks::measure(("particle arena" + particles).c_str(), nrOfParticles, "particle", [&] {
+			quads.clear();
+			for(auto range : ranges)
+				updateRangeOfArena(arena, range, amountOfParticles, quads);
+			sum += quads.back().position.y;
+		});
+
+		std::printf("  checksum %f\n", sum);
+	}
+}
+
+}
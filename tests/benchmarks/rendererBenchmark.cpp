@@ -0,0 +1,143 @@
+#include "benchmark.hpp"
+#include "Renderer/API/nullRenderingBackend.hpp"
+#include "Renderer/API/texture.hpp"
+#include "Renderer/MinorRenderers/quadRenderer.hpp"
+#include "Renderer/MinorRenderers/lightRenderer.hpp"
+#include "Renderer/MinorRenderers/pointRenderer.hpp"
+#include <array>
+#include <cstdio>
+
+// Workloads are the same as in tests/rendererTests/rendererTest.hpp but they are executed
+// by minor renderers directly with NullRenderingBackend, so only cpu side work is measured.
+
+namespace ph {
+
+namespace {
+	NullRenderingBackend nullBackend;
+
+	void printRecordedCallsOfOneRun(const std::function<void()>& run)
+	{
+		nullBackend.clearRecordedCalls();
+		run();
+		auto& recorded = nullBackend.getRecordedCalls();
+		std::printf("  %-45s %zu draw calls, %zu backend calls, %zu bytes uploaded, %zu texture binds\n",
+			"", recorded.drawCalls, recorded.calls, recorded.uploadedBytes, recorded.textureBinds);
+	}
+}
+
+PH_BENCHMARK(quadRenderer)
+{
+	RenderingBackend::setCurrent(&nullBackend);
+
+	const FloatRect screenBounds(-2000.f, -2000.f, 4000.f, 130000.f);
+	QuadRenderer quadRenderer;
+	quadRenderer.init();
+	quadRenderer.setScreenBoundsPtr(&screenBounds);
+
+	{
+		std::array<Texture, 33> textures;
+		unsigned pixels[16 * 16] = {};
+		for(auto& texture : textures)
+			texture.setData(pixels, sizeof(pixels), {16, 16});
+
+		const IntRect textureRect(5, 5, 10, 10);
+		constexpr int nrOfRows = 2500;
+		constexpr size_t nrOfQuads = nrOfRows * 33 + 1;
+
+		auto submitRendererTestQuads = [&] {
+			quadRenderer.submitQuad(&textures[10], nullptr, nullptr, nullptr, {-1500.f, 0.f}, {3000.f, 3000.f}, 0.9f, 0.f, {});
+			for(int i = 0; i < nrOfRows; ++i) {
+				for(int t = 0; t < 33; ++t) {
+					const sf::Vector2f position(-550.f + t * 50.f, i * 50.f);
+					const float rotation = t == 0 ? 45.f : t == 1 ? 123.f : 0.f;
+					const sf::Color* color = t == 1 ? &sf::Color::Red : t == 14 ? &sf::Color::Yellow : nullptr;
+					const IntRect* rect = t == 6 ? &textureRect : nullptr;
+					quadRenderer.submitQuad(&textures[t], rect, color, nullptr, position, {20.f, 30.f}, 0.1f, rotation, {});
+				}
+			}
+		};
+
+		Benchmarks::measure("submitQuad (33 textures)", nrOfQuads, "quad", submitRendererTestQuads, [&] {
+			quadRenderer.flush();
+		});
+		Benchmarks::measure("submitQuad + flush (33 textures)", nrOfQuads, "quad", [&] {
+			submitRendererTestQuads();
+			quadRenderer.flush();
+		});
+		printRecordedCallsOfOneRun([&] {
+			submitRendererTestQuads();
+			quadRenderer.flush();
+		});
+
+		std::vector<QuadData> bunch;
+		for(int x = 0; x < 100; ++x)
+			for(int y = 0; y < 100; ++y) {
+				QuadData qd;
+				qd.position = {x * 20.f, y * 20.f};
+				qd.rotation = 0.f;
+				qd.size = {20.f, 20.f};
+				qd.textureRect = FloatRect(0.f, 0.f, 1.f, 1.f);
+				qd.textureSlotRef = 0.f;
+				qd.color = Vector4f{1.f, 1.f, 1.f, 1.f};
+				bunch.emplace_back(qd);
+			}
+		Benchmarks::measure("submitBunchOfQuadsWithTheSameTexture + flush", bunch.size(), "quad", [&] {
+			quadRenderer.submitBunchOfQuadsWithTheSameTexture(bunch.data(), bunch.size(), &textures[7], nullptr, 0.2f);
+			quadRenderer.flush();
+		});
+	}
+
+	quadRenderer.shutDown();
+	RenderingBackend::setCurrent(nullptr);
+}
+
+PH_BENCHMARK(lightRenderer)
+{
+	RenderingBackend::setCurrent(&nullBackend);
+
+	const FloatRect screenBounds(0.f, 0.f, 640.f, 360.f);
+	LightRenderer lightRenderer;
+	lightRenderer.init();
+	lightRenderer.setScreenBoundsPtr(&screenBounds);
+
+	for(size_t nrOfBlockingQuads : {0, 50, 200})
+	{
+		constexpr size_t nrOfLights = 10;
+		auto submitAndFlush = [&] {
+			for(size_t i = 0; i < nrOfBlockingQuads; ++i)
+				lightRenderer.submitLightBlockingQuad({(i % 20) * 32.f, (i / 20) * 32.f}, {16.f, 16.f});
+			for(size_t i = 0; i < nrOfLights; ++i)
+				lightRenderer.submitLight({sf::Color::White, {i * 64.f + 8.f, 180.f}, 0.f, 360.f, 0.4f, 3.f, 20.f});
+			lightRenderer.flush();
+		};
+		char name[64];
+		std::snprintf(name, sizeof(name), "360 degree lights, %zu blocking quads", nrOfBlockingQuads);
+		Benchmarks::measure(name, nrOfLights, "light", submitAndFlush);
+		printRecordedCallsOfOneRun(submitAndFlush);
+	}
+
+	lightRenderer.shutDown();
+	RenderingBackend::setCurrent(nullptr);
+}
+
+PH_BENCHMARK(pointRenderer)
+{
+	RenderingBackend::setCurrent(&nullBackend);
+
+	const FloatRect screenBounds(-2000.f, -2000.f, 4000.f, 4000.f);
+	PointRenderer pointRenderer;
+	pointRenderer.init();
+	pointRenderer.setScreenBoundsPtr(&screenBounds);
+
+	constexpr size_t nrOfPoints = 10000;
+	Benchmarks::measure("submitPoint + flush", nrOfPoints, "point", [&] {
+		for(size_t i = 0; i < nrOfPoints; ++i)
+			pointRenderer.submitPoint({(i % 100) * 10.f, (i / 100) * 10.f}, sf::Color(char(i * 20), char(i * 10), char(i * 5)), 0.f, 10.f);
+		pointRenderer.flush();
+	});
+
+	pointRenderer.shutDown();
+	RenderingBackend::setCurrent(nullptr);
+}
+
+}
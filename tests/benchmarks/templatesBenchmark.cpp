@@ -0,0 +1,84 @@
+#include "benchmark.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/objectsComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+#include "ECS/Components/itemComponents.hpp"
+#include "ECS/Components/particleComponents.hpp"
+#include "ECS/Components/aiComponents.hpp"
+#include <entt/entity/registry.hpp>
+
+// Compares copying templates through all pools of the template registry, which createCopy() did before,
+// with copying compiled blueprints. Template registry has also other templates, like the one loaded from ecsTemplates.xml.
+
+namespace ph {
+
+namespace {
+	constexpr size_t nrOfCopies = 1000;
+
+	void createTemplates(EntitiesTemplateStorage& templates)
+	{
+		templates.create("Zombie");
+		templates.assign<component::Health>("Zombie", 100, 100);
+		templates.assign<component::KinematicCollisionBody>("Zombie", 5.f);
+		templates.assign<component::Damage>("Zombie", 25);
+		templates.assign<component::CollisionWithPlayer>("Zombie", 2.f, false);
+		templates.assign<component::BodyRect>("Zombie", FloatRect(0.f, 0.f, 20.f, 20.f));
+		templates.assign<component::CharacterSpeed>("Zombie", 50.f);
+		templates.assign<component::Velocity>("Zombie", 0.f, 0.f);
+		templates.assign<component::PushingForces>("Zombie");
+		templates.assign<component::Zombie>("Zombie");
+		templates.assign<component::Killable>("Zombie");
+		templates.assign<component::RenderQuad>("Zombie");
+		templates.assign<component::TextureRect>("Zombie");
+		templates.assign<component::MultiParticleEmitter>("Zombie");
+
+		templates.create("Gate");
+		templates.assign<component::BodyRect>("Gate", FloatRect(0.f, 0.f, 40.f, 10.f));
+		templates.assign<component::StaticCollisionBody>("Gate");
+		templates.assign<component::LightWall>("Gate");
+		templates.assign<component::Gate>("Gate", false);
+		templates.assign<component::LeverListener>("Gate");
+
+		templates.create("Medkit");
+		templates.assign<component::Medkit>("Medkit", 25);
+		templates.assign<component::BodyRect>("Medkit", FloatRect(0.f, 0.f, 15.f, 15.f));
+		templates.assign<component::RenderQuad>("Medkit");
+
+		templates.create("Car");
+		templates.assign<component::Car>("Car");
+		templates.assign<component::BodyRect>("Car", FloatRect(0.f, 0.f, 38.f, 18.f));
+		templates.assign<component::StaticCollisionBody>("Car");
+		templates.assign<component::HiddenForRenderer>("Car");
+		templates.assign<component::LightSource>("Car");
+		templates.assign<component::PushingArea>("Car");
+		templates.assign<component::Lever>("Car");
+		templates.assign<component::Bullets>("Car");
+	}
+}
+
+PH_BENCHMARK(templatesCopying)
+{
+	EntitiesTemplateStorage templates;
+	createTemplates(templates);
+	entt::registry registry;
+
+	Benchmarks::measure("copy through template registry pools", nrOfCopies, "copy", [&] {
+		for(size_t i = 0; i < nrOfCopies; ++i)
+			registry.create(templates.getTemplate("Zombie"), templates.getTemplateRegistry());
+	}, [&] { registry.reset(); });
+
+	templates.compileBlueprints();
+
+	Benchmarks::measure("createCopy() of blueprint", nrOfCopies, "copy", [&] {
+		for(size_t i = 0; i < nrOfCopies; ++i)
+			templates.createCopy("Zombie", registry);
+	}, [&] { registry.reset(); });
+
+	Benchmarks::measure("createCopies() of blueprint", nrOfCopies, "copy", [&] {
+		templates.createCopies("Zombie", registry, nrOfCopies);
+	}, [&] { registry.reset(); });
+}
+
+}
@@ -0,0 +1,44 @@
+#include <catch.hpp>
+
+#include "ECS/Systems/animationSystem.hpp"
+#include "ECS/Components/animationComponents.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+
+namespace ph {
+
+TEST_CASE("Animation states are looked up and stopped animations are updated only after state changes", "[ECS][AnimationSystem]")
+{
+	AnimationStatesData states{
+		{"down", StateData{IntRect(0, 0, 10, 10), 3}},
+		{"up", StateData{IntRect(0, 10, 10, 10), 3}}
+	};
+
+	entt::registry registry;
+	system::AnimationSystem animationSystem(registry);
+
+	auto playing = registry.create();
+	registry.assign<component::AnimationData>(playing, component::AnimationData{"down", &states, 0.1f, 0.f, 0, true});
+	registry.assign<component::TextureRect>(playing);
+
+	auto stopped = registry.create();
+	registry.assign<component::AnimationData>(stopped, component::AnimationData{"down", &states, 0.1f, 0.f, 0, false});
+	registry.assign<component::TextureRect>(stopped);
+
+	animationSystem.update(0.15f);
+	CHECK(animationSystem.getNrOfSkippedStateLookups() == 0);
+	CHECK(registry.get<component::TextureRect>(playing).rect == IntRect(10, 0, 10, 10));
+	CHECK(registry.get<component::TextureRect>(stopped).rect == IntRect(0, 0, 10, 10));
+
+	animationSystem.update(0.01f);
+	CHECK(animationSystem.getNrOfSkippedStateLookups() == 2);
+	CHECK(animationSystem.getNrOfSkippedTextureRectUpdates() == 2);
+
+	registry.get<component::AnimationData>(stopped).currentStateName = "up";
+	animationSystem.update(0.1f);
+	CHECK(animationSystem.getNrOfSkippedStateLookups() == 1);
+	CHECK(animationSystem.getNrOfSkippedTextureRectUpdates() == 0);
+	CHECK(registry.get<component::TextureRect>(playing).rect == IntRect(20, 0, 10, 10));
+	CHECK(registry.get<component::TextureRect>(stopped).rect == IntRect(0, 10, 10, 10));
+}
+
+}
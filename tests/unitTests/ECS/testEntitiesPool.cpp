@@ -0,0 +1,74 @@
+#include <catch.hpp>
+
+#include "ECS/entitiesPool.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include <algorithm>
+
+namespace ph {
+
+namespace {
+	void createZombieTemplate(EntitiesTemplateStorage& templateStorage)
+	{
+		templateStorage.create("Zombie");
+		templateStorage.assign<component::Health>("Zombie", 100, 100);
+		templateStorage.assign<component::BodyRect>("Zombie", FloatRect(0.f, 0.f, 20.f, 20.f));
+	}
+}
+
+TEST_CASE("Deactivated entities are reused and reset from their template", "[ECS][EntitiesPool]")
+{
+	EntitiesTemplateStorage templateStorage;
+	createZombieTemplate(templateStorage);
+	entt::registry registry;
+	EntitiesPool pool(templateStorage);
+	pool.addComponentTypes<component::Health, component::BodyRect, component::DeadCharacter>();
+
+	auto zombies = pool.createCopies("Zombie", registry, 3);
+	REQUIRE(registry.has<component::Pooled>(zombies[0]));
+
+	// zombie dies and fades out
+	registry.get<component::Health>(zombies[0]).healthPoints = 0;
+	registry.get<component::BodyRect>(zombies[0]).rect.left = 300.f;
+	registry.assign<component::DeadCharacter>(zombies[0], 10.f);
+	pool.deactivate(zombies[0], registry);
+
+	REQUIRE_FALSE(registry.valid(zombies[0]));
+	REQUIRE(pool.getNrOfInactiveEntities("Zombie") == 1);
+
+	auto newZombies = pool.createCopies("Zombie", registry, 2);
+	const auto reusedZombie = std::find_if(newZombies.begin(), newZombies.end(), [&](entt::entity zombie) {
+		return registry.entity(zombie) == registry.entity(zombies[0]);
+	});
+	REQUIRE(reusedZombie != newZombies.end());
+	REQUIRE(pool.getNrOfInactiveEntities("Zombie") == 0);
+	REQUIRE(registry.size<component::Health>() == 4);
+	for(auto zombie : newZombies) {
+		CHECK(registry.get<component::Health>(zombie).healthPoints == 100);
+		CHECK(registry.get<component::BodyRect>(zombie).rect.left == 0.f);
+		CHECK_FALSE(registry.has<component::DeadCharacter>(zombie));
+		CHECK(registry.has<component::Pooled>(zombie));
+	}
+}
+
+TEST_CASE("Stale handle of deactivated entity can't reach entity which reuses it", "[ECS][EntitiesPool]")
+{
+	EntitiesTemplateStorage templateStorage;
+	createZombieTemplate(templateStorage);
+	entt::registry registry;
+	EntitiesPool pool(templateStorage);
+	pool.addComponentTypes<component::Health, component::BodyRect>();
+
+	// handle kept by system or queued event
+	const auto staleZombie = pool.createCopy("Zombie", registry);
+	pool.deactivate(staleZombie, registry);
+	const auto newZombie = pool.createCopy("Zombie", registry);
+
+	CHECK(registry.entity(newZombie) == registry.entity(staleZombie));
+	CHECK(newZombie != staleZombie);
+	CHECK_FALSE(registry.valid(staleZombie));
+	CHECK(registry.valid(newZombie));
+	CHECK(registry.has<component::Health>(newZombie));
+}
+
+}
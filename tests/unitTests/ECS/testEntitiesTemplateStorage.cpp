@@ -0,0 +1,69 @@
+#include <catch.hpp>
+
+#include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+
+namespace ph {
+
+namespace {
+	void createZombieTemplate(EntitiesTemplateStorage& templateStorage)
+	{
+		templateStorage.create("Zombie");
+		templateStorage.assign<component::Health>("Zombie", 100, 100);
+		templateStorage.assign<component::BodyRect>("Zombie", FloatRect(0.f, 0.f, 20.f, 20.f));
+		templateStorage.assign<component::Killable>("Zombie");
+	}
+
+	void requireZombieCopy(entt::registry& registry, entt::entity copy)
+	{
+		REQUIRE(registry.get<component::Health>(copy).healthPoints == 100);
+		REQUIRE(registry.get<component::BodyRect>(copy).rect.width == 20.f);
+		REQUIRE(registry.has<component::Killable>(copy));
+		REQUIRE_FALSE(registry.has<component::Velocity>(copy));
+	}
+}
+
+TEST_CASE("Template storage creates many copies at once", "[ECS][EntitiesTemplateStorage]")
+{
+	EntitiesTemplateStorage templateStorage;
+	createZombieTemplate(templateStorage);
+	entt::registry registry;
+
+	auto copies = templateStorage.createCopies<component::Health, component::BodyRect>("Zombie", registry, 10);
+
+	REQUIRE(copies.size() == 10);
+	REQUIRE(registry.capacity<component::Health>() >= 10);
+	for(auto copy : copies)
+		requireZombieCopy(registry, copy);
+}
+
+TEST_CASE("Copies of compiled templates are the same as copies of template entities", "[ECS][EntitiesTemplateStorage]")
+{
+	EntitiesTemplateStorage templateStorage;
+	createZombieTemplate(templateStorage);
+	templateStorage.create("Box");
+	templateStorage.assign<component::Velocity>("Box", 1.f, 2.f);
+	templateStorage.compileBlueprints();
+	entt::registry registry;
+
+	SECTION("createCopy") {
+		requireZombieCopy(registry, templateStorage.createCopy("Zombie", registry));
+	}
+	SECTION("createCopies") {
+		for(auto copy : templateStorage.createCopies("Zombie", registry, 3))
+			requireZombieCopy(registry, copy);
+	}
+	SECTION("stomp replaces components which entity already has") {
+		auto entity = registry.create();
+		registry.assign<component::Health>(entity, 5, 5);
+		templateStorage.stomp(entity, "Zombie", registry);
+		requireZombieCopy(registry, entity);
+	}
+	SECTION("template changed after compilation") {
+		templateStorage.assign_or_replace<component::Health>("Zombie", 50, 50);
+		REQUIRE(registry.get<component::Health>(templateStorage.createCopy("Zombie", registry)).healthPoints == 50);
+	}
+}
+
+}
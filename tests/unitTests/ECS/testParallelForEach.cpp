@@ -0,0 +1,86 @@
+#include <catch.hpp>
+
+#include "ECS/parallelForEach.hpp"
+#include <entt/entity/registry.hpp>
+#include <atomic>
+#include <vector>
+
+namespace ph {
+
+namespace {
+	struct Value { int value; };
+	struct Doubled { int value; };
+	struct Skipped {};
+}
+
+TEST_CASE("Job system calls parallelFor function once for every index", "[Utilities][JobSystem]")
+{
+	JobSystem jobSystem(3);
+	std::vector<std::atomic<int>> calls(10007);
+
+	jobSystem.parallelFor(calls.size(), 100, [&calls](size_t begin, size_t end) {
+		for(size_t i = begin; i < end; ++i)
+			++calls[i];
+	});
+
+	for(auto& nrOfCalls : calls)
+		REQUIRE(nrOfCalls == 1);
+}
+
+TEST_CASE("Jobs can wait for other jobs", "[Utilities][JobSystem]")
+{
+	JobSystem jobSystem(2);
+	std::atomic<int> sum{0};
+
+	jobSystem.parallelFor(8, 1, [&jobSystem, &sum](size_t begin, size_t end) {
+		jobSystem.parallelFor(1000, 10, [&sum](size_t innerBegin, size_t innerEnd) {
+			sum += static_cast<int>(innerEnd - innerBegin);
+		});
+	});
+
+	CHECK(sum == 8000);
+}
+
+TEST_CASE("parallelForEach gives the same results as view.each()", "[ECS][parallelForEach]")
+{
+	JobSystem jobSystem(3);
+	entt::registry registry;
+	for(int i = 0; i < 5000; ++i) {
+		auto entity = registry.create();
+		registry.assign<Value>(entity, i);
+		registry.assign<Doubled>(entity, 0);
+		if(i % 3 == 0)
+			registry.assign<Skipped>(entity);
+	}
+
+	SECTION("view of one component") {
+		parallelForEach<Value>(registry, [](Value& v) { v.value += 1; }, entt::exclude<>, jobSystem, 64);
+		registry.view<Value>().each([](entt::entity entity, const Value& v) {
+			REQUIRE(v.value == static_cast<int>(entt::to_integer(entity)) + 1);
+		});
+	}
+	SECTION("view of many components with excluded component") {
+		parallelForEach<Value, Doubled>(registry, [](entt::entity, const Value& v, Doubled& d) { d.value = v.value * 2; },
+		                                entt::exclude<Skipped>, jobSystem, 64);
+
+		registry.view<Value, Doubled>().each([&registry](entt::entity entity, const Value& v, const Doubled& d) {
+			if(registry.has<Skipped>(entity))
+				REQUIRE(d.value == 0);
+			else
+				REQUIRE(d.value == v.value * 2);
+		});
+	}
+	SECTION("partial-owning group") {
+		auto group = registry.group<Value>(entt::get<Doubled>, entt::exclude<Skipped>);
+		parallelForEach(group, [](const Value& v, Doubled& d) { d.value = v.value * 2; }, jobSystem, 64);
+
+		registry.view<Value, Doubled>().each([&registry](entt::entity entity, const Value& v, const Doubled& d) {
+			if(registry.has<Skipped>(entity))
+				REQUIRE(d.value == 0);
+			else
+				REQUIRE(d.value == v.value * 2);
+		});
+	}
+}
+
+}
@@ -0,0 +1,76 @@
+#include <catch.hpp>
+
+#include "ECS/particleArena.hpp"
+
+namespace ph {
+
+TEST_CASE("Particles of a range are kept as ring and die in the order they were spawned", "[ECS][ParticleArena]")
+{
+	ParticleArena arena;
+	const auto range = arena.allocateRange(3);
+	const Vector4f white{1.f, 1.f, 1.f, 1.f};
+	const Vector4f transparent{1.f, 1.f, 1.f, 0.f};
+	std::vector<QuadData> quads;
+
+	arena.spawn(range, {0.f, 0.f}, {10.f, 0.f});
+	arena.update(range, 0.5f, {0.f, 0.f}, white, transparent, 1.f);
+	arena.spawn(range, {0.f, 0.f}, {0.f, 10.f});
+	arena.spawn(range, {0.f, 0.f}, {0.f, 0.f});
+	arena.update(range, 0.5f, {0.f, 0.f}, white, transparent, 1.f);
+	REQUIRE(arena.getNrOfParticles(range) == 3);
+	CHECK(arena.getLifetimeOfNewestParticle(range) == 0.5f);
+
+	arena.killOldParticles(range, 1.f);
+	REQUIRE(arena.getNrOfParticles(range) == 2);
+
+	// spawned particle takes place of the dead one at the front of the range
+	arena.spawn(range, {100.f, 100.f}, {0.f, 0.f});
+	arena.update(range, 0.25f, {0.f, 4.f}, white, transparent, 1.f);
+	arena.appendQuads(range, {-1.f, -1.f}, {2.f, 2.f}, quads);
+	REQUIRE(quads.size() == 3);
+	CHECK(quads[0].position == sf::Vector2f(-1.f, 6.75f));
+	CHECK(quads[0].color.w == 0.25f);
+	CHECK(quads[1].position == sf::Vector2f(-1.f, -0.75f));
+	CHECK(quads[2].position == sf::Vector2f(99.f, 99.25f));
+	CHECK(quads[2].color.w == 0.75f);
+	CHECK(quads[2].size == sf::Vector2f(2.f, 2.f));
+	CHECK(arena.getLifetimeOfNewestParticle(range) == 0.25f);
+}
+
+TEST_CASE("Freed ranges of particle arena are reused", "[ECS][ParticleArena]")
+{
+	ParticleArena arena;
+	const auto a = arena.allocateRange(10);
+	const auto b = arena.allocateRange(20);
+	const auto c = arena.allocateRange(5);
+	REQUIRE(arena.getCapacity() == 35);
+
+	arena.freeRange(a);
+	arena.freeRange(b);
+	REQUIRE(arena.getNrOfRanges() == 1);
+
+	// merged block of a and b is big enough
+	const auto d = arena.allocateRange(25);
+	CHECK(arena.getCapacity() == 35);
+	CHECK(arena.getNrOfRanges() == 2);
+	CHECK((d == a || d == b));
+
+	// the rest of merged block is too small, so arena grows
+	const auto e = arena.allocateRange(10);
+	CHECK(arena.getCapacity() == 45);
+
+	// free block at the end of arena is extended instead of being left behind
+	arena.freeRange(e);
+	const auto f = arena.allocateRange(12);
+	CHECK(arena.getCapacity() == 47);
+	arena.spawn(f, {1.f, 2.f}, {0.f, 0.f});
+	CHECK(arena.getNrOfParticles(f) == 1);
+	CHECK(arena.getNrOfParticles(c) == 0);
+	CHECK(arena.getNrOfRanges() == 3);
+
+	const auto empty = arena.allocateRange(0);
+	CHECK(arena.getNrOfParticles(empty) == 0);
+	CHECK(arena.getCapacity() == 47);
+}
+
+}
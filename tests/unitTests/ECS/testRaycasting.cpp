@@ -0,0 +1,43 @@
+#include <catch.hpp>
+
+#include "ECS/raycasting.hpp"
+
+namespace ph {
+
+TEST_CASE("Ray hits rects which are in its way", "[ECS][Raycasting]")
+{
+	const FloatRect rect(10.f, -5.f, 10.f, 10.f);
+
+	CHECK(getRayDistanceToRect({0.f, 0.f}, {1.f, 0.f}, rect, 100.f) == Approx(10.f));
+	CHECK(getRayDistanceToRect({0.f, 0.f}, {2.f, 0.f}, rect, 100.f) == Approx(5.f));
+	CHECK(getRayDistanceToRect({15.f, 0.f}, {1.f, 0.f}, rect, 100.f) == Approx(0.f));
+	CHECK(getRayDistanceToRect({0.f, -20.f}, {1.f, 1.f}, rect, 100.f) == Approx(15.f));
+
+	SECTION("Ray misses rect") {
+		CHECK(getRayDistanceToRect({0.f, 0.f}, {-1.f, 0.f}, rect, 100.f) == 100.f);
+		CHECK(getRayDistanceToRect({0.f, 10.f}, {1.f, 0.f}, rect, 100.f) == 100.f);
+		CHECK(getRayDistanceToRect({0.f, 0.f}, {1.f, 0.f}, rect, 8.f) == 8.f);
+	}
+}
+
+TEST_CASE("Ray stops at the first solid tile which it crosses", "[ECS][Raycasting]")
+{
+	// 8x8 map of 16 px tiles with solid tiles at (5, 1) and (2, 6)
+	component::TileCollisionBitmap bitmap{std::vector<bool>(64, false), sf::Vector2u(8, 8), sf::Vector2f(16.f, 16.f)};
+	bitmap.solidTiles[1 * 8 + 5] = true;
+	bitmap.solidTiles[6 * 8 + 2] = true;
+
+	CHECK(getRayDistanceToSolidTile({8.f, 24.f}, {1.f, 0.f}, bitmap, 200.f) == Approx(72.f));
+	CHECK(getRayDistanceToSolidTile({40.f, 8.f}, {0.f, 1.f}, bitmap, 200.f) == Approx(88.f));
+	CHECK(getRayDistanceToSolidTile({8.f, 40.f}, {0.5f, 1.f}, bitmap, 200.f) == Approx(56.f));
+
+	SECTION("Ray doesn't reach solid tile") {
+		CHECK(getRayDistanceToSolidTile({8.f, 24.f}, {1.f, 0.f}, bitmap, 50.f) == 50.f);
+		CHECK(getRayDistanceToSolidTile({8.f, 40.f}, {1.f, 0.f}, bitmap, 200.f) == 200.f);
+	}
+	SECTION("Ray which starts outside of the map") {
+		CHECK(getRayDistanceToSolidTile({-40.f, 24.f}, {1.f, 0.f}, bitmap, 200.f) == Approx(120.f));
+	}
+}
+
+}
@@ -0,0 +1,46 @@
+#include <catch.hpp>
+
+#include "ECS/registryGroups.hpp"
+#include "ECS/Systems/movement.hpp"
+#include <vector>
+
+namespace ph {
+
+TEST_CASE("Moving bodies leave and join nested groups", "[ECS][RegistryGroups]")
+{
+	entt::registry registry;
+	Groups::createGroups(registry);
+
+	std::vector<entt::entity> bodies(6);
+	registry.create(bodies.begin(), bodies.end());
+	for(auto body : bodies) {
+		registry.assign<component::BodyRect>(body, FloatRect(0.f, 0.f, 10.f, 10.f));
+		registry.assign<component::Velocity>(body, 10.f, 0.f);
+	}
+	registry.assign<component::KinematicCollisionBody>(bodies[1]);
+	registry.assign<component::KinematicCollisionBody>(bodies[4]);
+	registry.assign<component::Sleeping>(bodies[2]);
+	registry.assign<component::PushingForces>(bodies[3], sf::Vector2f(1.f, 0.f));
+	registry.assign<component::PushingForces>(bodies[5]);
+
+	REQUIRE(Groups::movingBodies(registry).size() == 5);
+	REQUIRE(Groups::kinematicBodies(registry).size() == 2);
+	REQUIRE(Groups::kinematicBodies(registry).contains(bodies[4]));
+
+	registry.assign<component::Sleeping>(bodies[4]);
+	REQUIRE(Groups::movingBodies(registry).size() == 4);
+	REQUIRE(Groups::kinematicBodies(registry).size() == 1);
+
+	system::Movement movement(registry);
+	movement.update(1.f);
+
+	// sleeping bodies aren't moved and pushed bodies are moved by PushingMovement
+	REQUIRE(registry.get<component::BodyRect>(bodies[0]).rect.left == 10.f);
+	REQUIRE(registry.get<component::BodyRect>(bodies[1]).rect.left == 10.f);
+	REQUIRE(registry.get<component::BodyRect>(bodies[2]).rect.left == 0.f);
+	REQUIRE(registry.get<component::BodyRect>(bodies[3]).rect.left == 0.f);
+	REQUIRE(registry.get<component::BodyRect>(bodies[4]).rect.left == 0.f);
+	REQUIRE(registry.get<component::BodyRect>(bodies[5]).rect.left == 10.f);
+}
+
+}
@@ -0,0 +1,73 @@
+#include <catch.hpp>
+
+#include "ECS/Systems/sleepingBodies.hpp"
+#include "ECS/Systems/spatialHashUpdate.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+
+namespace ph {
+
+namespace {
+	entt::entity createBody(entt::registry& registry, const FloatRect& rect)
+	{
+		auto entity = registry.create();
+		registry.assign<component::BodyRect>(entity, rect);
+		registry.assign<component::Velocity>(entity, 0.f, 0.f);
+		registry.assign<component::KinematicCollisionBody>(entity, 50.f);
+		return entity;
+	}
+}
+
+TEST_CASE("Body at rest falls asleep and wakes when it gets velocity", "[ECS][SleepingBodies]")
+{
+	entt::registry registry;
+	system::SpatialHashUpdate spatialHashUpdate(registry);
+	system::SleepingBodies sleepingBodies(registry, 1.f);
+	auto body = createBody(registry, FloatRect(0.f, 0.f, 10.f, 10.f));
+
+	sleepingBodies.update(0.6f);
+	REQUIRE_FALSE(registry.has<component::Sleeping>(body));
+	sleepingBodies.update(0.6f);
+	REQUIRE(registry.has<component::Sleeping>(body));
+
+	registry.get<component::Velocity>(body).dx = 5.f;
+	sleepingBodies.update(0.6f);
+	REQUIRE_FALSE(registry.has<component::Sleeping>(body));
+
+	// timer starts again after waking
+	registry.get<component::Velocity>(body).dx = 0.f;
+	sleepingBodies.update(0.6f);
+	REQUIRE_FALSE(registry.has<component::Sleeping>(body));
+}
+
+TEST_CASE("Sleeping body wakes when something touches it", "[ECS][SleepingBodies]")
+{
+	entt::registry registry;
+	system::SpatialHashUpdate spatialHashUpdate(registry);
+	system::SleepingBodies sleepingBodies(registry, 1.f);
+	auto sleepingBody = createBody(registry, FloatRect(0.f, 0.f, 10.f, 10.f));
+	auto farBody = createBody(registry, FloatRect(200.f, 0.f, 10.f, 10.f));
+	sleepingBodies.update(1.f);
+	REQUIRE(registry.has<component::Sleeping>(sleepingBody));
+	REQUIRE(registry.has<component::Sleeping>(farBody));
+
+	SECTION("Moving kinematic body") {
+		auto movingBody = createBody(registry, FloatRect(5.f, 5.f, 10.f, 10.f));
+		registry.get<component::Velocity>(movingBody).dy = 10.f;
+		spatialHashUpdate.update(0.f);
+		sleepingBodies.update(0.1f);
+		REQUIRE_FALSE(registry.has<component::Sleeping>(sleepingBody));
+		REQUIRE(registry.has<component::Sleeping>(farBody));
+	}
+	SECTION("Static body which appears on it") {
+		auto gate = registry.create();
+		registry.assign<component::BodyRect>(gate, FloatRect(0.f, 8.f, 40.f, 4.f));
+		registry.assign<component::StaticCollisionBody>(gate);
+		REQUIRE(registry.has<component::Sleeping>(sleepingBody));
+		spatialHashUpdate.update(0.f);
+		sleepingBodies.update(0.1f);
+		REQUIRE_FALSE(registry.has<component::Sleeping>(sleepingBody));
+		REQUIRE(registry.has<component::Sleeping>(farBody));
+	}
+}
+
+}
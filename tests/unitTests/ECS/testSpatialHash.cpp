@@ -0,0 +1,67 @@
+#include <catch.hpp>
+
+#include "ECS/spatialHash.hpp"
+#include <vector>
+
+namespace ph {
+
+namespace {
+	entt::entity toEntity(unsigned id)
+	{
+		return static_cast<entt::entity>(id);
+	}
+}
+
+TEST_CASE("Spatial hash returns entities from cells overlapped by query", "[ECS][SpatialHash]")
+{
+	SpatialHash spatialHash(10.f);
+	spatialHash.insertOrUpdate(toEntity(1), FloatRect(1.f, 1.f, 5.f, 5.f));
+	spatialHash.insertOrUpdate(toEntity(2), FloatRect(15.f, 1.f, 20.f, 5.f));
+	spatialHash.insertOrUpdate(toEntity(3), FloatRect(-30.f, -30.f, 5.f, 5.f));
+	std::vector<entt::entity> result;
+
+	SECTION("rect query") {
+		spatialHash.queryRect(FloatRect(0.f, 0.f, 12.f, 3.f), result);
+		REQUIRE(result == std::vector<entt::entity>{toEntity(1), toEntity(2)});
+
+		spatialHash.queryRect(FloatRect(-25.f, -25.f, 1.f, 1.f), result);
+		REQUIRE(result == std::vector<entt::entity>{toEntity(3)});
+
+		spatialHash.queryRect(FloatRect(100.f, 100.f, 1.f, 1.f), result);
+		REQUIRE(result.empty());
+	}
+
+	SECTION("point query") {
+		spatialHash.queryPoint({25.f, 5.f}, result);
+		REQUIRE(result == std::vector<entt::entity>{toEntity(2)});
+
+		spatialHash.queryPoint({5.f, 15.f}, result);
+		REQUIRE(result.empty());
+	}
+
+	SECTION("entity which overlaps many cells is returned once") {
+		spatialHash.queryRect(FloatRect(0.f, 0.f, 40.f, 40.f), result);
+		REQUIRE(result == std::vector<entt::entity>{toEntity(1), toEntity(2)});
+	}
+}
+
+TEST_CASE("Spatial hash moves updated entities between cells", "[ECS][SpatialHash]")
+{
+	SpatialHash spatialHash(10.f);
+	spatialHash.insertOrUpdate(toEntity(1), FloatRect(1.f, 1.f, 5.f, 5.f));
+	spatialHash.insertOrUpdate(toEntity(1), FloatRect(51.f, 1.f, 5.f, 5.f));
+	std::vector<entt::entity> result;
+
+	spatialHash.queryPoint({2.f, 2.f}, result);
+	REQUIRE(result.empty());
+	spatialHash.queryPoint({52.f, 2.f}, result);
+	REQUIRE(result == std::vector<entt::entity>{toEntity(1)});
+	REQUIRE(spatialHash.getNrOfEntities() == 1);
+
+	spatialHash.remove(toEntity(1));
+	spatialHash.queryPoint({52.f, 2.f}, result);
+	REQUIRE(result.empty());
+	REQUIRE_FALSE(spatialHash.contains(toEntity(1)));
+}
+
+}
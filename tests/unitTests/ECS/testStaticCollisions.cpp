@@ -0,0 +1,39 @@
+#include <catch.hpp>
+
+#include "ECS/Systems/staticCollisions.hpp"
+#include "ECS/Systems/spatialHashUpdate.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+
+namespace ph {
+
+TEST_CASE("Kinematic bodies are pushed out of solid tiles of collision bitmap", "[ECS][StaticCollisions]")
+{
+	entt::registry registry;
+	system::SpatialHashUpdate spatialHashUpdate(registry);
+	system::StaticCollisions staticCollisions(registry);
+
+	// 4x4 map of 16 px tiles with solid column at x = 2
+	component::TileCollisionBitmap bitmap{std::vector<bool>(16, false), sf::Vector2u(4, 4), sf::Vector2f(16.f, 16.f)};
+	for(unsigned y = 0; y < 4; ++y)
+		bitmap.solidTiles[y * 4 + 2] = true;
+	registry.assign<component::TileCollisionBitmap>(registry.create(), bitmap);
+
+	auto body = registry.create();
+	registry.assign<component::BodyRect>(body, FloatRect(22.f, 20.f, 12.f, 12.f));
+	registry.assign<component::KinematicCollisionBody>(body);
+
+	auto bodyOutsideMap = registry.create();
+	registry.assign<component::BodyRect>(bodyOutsideMap, FloatRect(-30.f, 100.f, 12.f, 12.f));
+	registry.assign<component::KinematicCollisionBody>(bodyOutsideMap);
+
+	spatialHashUpdate.update(0.f);
+	staticCollisions.update(0.f);
+
+	REQUIRE(registry.get<component::BodyRect>(body).rect.left == 20.f);
+	REQUIRE(registry.get<component::BodyRect>(body).rect.top == 20.f);
+	REQUIRE(registry.get<component::KinematicCollisionBody>(body).staticallyMovedByX);
+	REQUIRE_FALSE(registry.get<component::KinematicCollisionBody>(body).staticallyMovedByY);
+	REQUIRE(registry.get<component::BodyRect>(bodyOutsideMap).rect.left == -30.f);
+}
+
+}
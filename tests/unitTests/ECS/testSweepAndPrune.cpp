@@ -0,0 +1,57 @@
+#include <catch.hpp>
+
+#include "ECS/sweepAndPrune.hpp"
+#include <vector>
+#include <utility>
+
+namespace ph {
+
+namespace {
+	using Pairs = std::vector<std::pair<entt::entity, entt::entity>>;
+
+	entt::entity toEntity(unsigned id)
+	{
+		return static_cast<entt::entity>(id);
+	}
+}
+
+TEST_CASE("Sweep and prune finds only overlapping pairs", "[ECS][SweepAndPrune]")
+{
+	SweepAndPrune sweepAndPrune;
+	sweepAndPrune.setBody(toEntity(3), FloatRect(0.f, 0.f, 10.f, 10.f));
+	sweepAndPrune.setBody(toEntity(1), FloatRect(5.f, 5.f, 10.f, 10.f));
+	sweepAndPrune.setBody(toEntity(2), FloatRect(5.f, 50.f, 10.f, 10.f));
+	sweepAndPrune.setBody(toEntity(4), FloatRect(10.f, 0.f, 10.f, 6.f));
+	sweepAndPrune.update();
+
+	// 3 and 4 only touch
+	REQUIRE(sweepAndPrune.getOverlappingPairs() == Pairs{{toEntity(1), toEntity(3)}, {toEntity(1), toEntity(4)}});
+}
+
+TEST_CASE("Sweep and prune follows moved, added and removed bodies", "[ECS][SweepAndPrune]")
+{
+	SweepAndPrune sweepAndPrune;
+	auto setBodies = [&](float secondBodyLeft, bool withThirdBody) {
+		sweepAndPrune.setBody(toEntity(1), FloatRect(0.f, 0.f, 10.f, 10.f));
+		sweepAndPrune.setBody(toEntity(2), FloatRect(secondBodyLeft, 0.f, 10.f, 10.f));
+		if(withThirdBody)
+			sweepAndPrune.setBody(toEntity(3), FloatRect(-5.f, 5.f, 10.f, 10.f));
+		sweepAndPrune.update();
+	};
+
+	setBodies(20.f, false);
+	REQUIRE(sweepAndPrune.getOverlappingPairs().empty());
+
+	setBodies(5.f, false);
+	REQUIRE(sweepAndPrune.getOverlappingPairs() == Pairs{{toEntity(1), toEntity(2)}});
+
+	setBodies(-30.f, true);
+	REQUIRE(sweepAndPrune.getOverlappingPairs() == Pairs{{toEntity(1), toEntity(3)}});
+	REQUIRE(sweepAndPrune.getNrOfBodies() == 3);
+
+	setBodies(-30.f, false);
+	REQUIRE(sweepAndPrune.getOverlappingPairs().empty());
+	REQUIRE(sweepAndPrune.getNrOfBodies() == 2);
+}
+
+}
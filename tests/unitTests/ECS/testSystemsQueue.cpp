@@ -0,0 +1,330 @@
+#include <catch.hpp>
+
+#include "ECS/systemsQueue.hpp"
+#include "Utilities/jobSystem.hpp"
+#include <thread>
+#include <stdexcept>
+
+namespace ph {
+
+namespace {
+	struct Position { float x; };
+	struct Speed { float x; };
+	struct Distance { float x; };
+
+	struct ExecutionLog
+	{
+		std::vector<int> order;
+		std::thread::id mainThreadSystemThread;
+	};
+
+	class Accelerate : public system::System
+	{
+	public:
+		using System::System;
+		void declareAccess(SystemAccess& access) const override { access.writes<Speed>(); }
+		void update(float dt) override {
+			mRegistry.view<Speed>().each([dt](Speed& speed) { speed.x += dt; });
+		}
+	};
+
+	class Move : public system::System
+	{
+	public:
+		using System::System;
+		void declareAccess(SystemAccess& access) const override { access.reads<Speed>().writes<Position>(); }
+		void update(float dt) override {
+			mRegistry.view<Position, Speed>().each([dt](Position& position, const Speed& speed) { position.x += speed.x * dt; });
+		}
+	};
+
+	class MeasureDistance : public system::System
+	{
+	public:
+		using System::System;
+		void declareAccess(SystemAccess& access) const override { access.reads<Position>().writes<Distance>(); }
+		void update(float dt) override {
+			mRegistry.view<Position, Distance>().each([](const Position& position, Distance& distance) { distance.x = position.x; });
+		}
+	};
+
+	class Logging : public system::System
+	{
+	public:
+		Logging(entt::registry& registry, ExecutionLog* log, int id)
+			:System(registry)
+			,mLog(log)
+			,mId(id)
+		{
+		}
+		void declareAccess(SystemAccess& access) const override { access.uses<ExecutionLog>(); }
+		void update(float dt) override { mLog->order.emplace_back(mId); }
+
+	private:
+		ExecutionLog* mLog;
+		int mId;
+	};
+
+	class MainThreadOnly : public system::System
+	{
+	public:
+		MainThreadOnly(entt::registry& registry, ExecutionLog* log)
+			:System(registry)
+			,mLog(log)
+		{
+		}
+		void declareAccess(SystemAccess& access) const override { access.runsOnMainThread(); }
+		void update(float dt) override { mLog->mainThreadSystemThread = std::this_thread::get_id(); }
+
+	private:
+		ExecutionLog* mLog;
+	};
+
+	class TimeStepLogging : public system::System
+	{
+	public:
+		TimeStepLogging(entt::registry& registry, std::vector<float>* timeSteps)
+			:System(registry)
+			,mTimeSteps(timeSteps)
+		{
+		}
+		void declareAccess(SystemAccess&) const override {}
+		void update(float dt) override { mTimeSteps->emplace_back(dt); }
+
+	private:
+		std::vector<float>* mTimeSteps;
+	};
+
+	template<int Id>
+	class IntervalLogging : public TimeStepLogging
+	{
+	public:
+		using TimeStepLogging::TimeStepLogging;
+	};
+
+	class Throwing : public system::System
+	{
+	public:
+		using System::System;
+		void declareAccess(SystemAccess&) const override {}
+		void update(float dt) override { throw std::runtime_error("system failed"); }
+	};
+
+	struct Hit { int damage; };
+	struct Noise { float volume; };
+
+	class Emitting : public system::System
+	{
+	public:
+		using System::System;
+		void declareAccess(SystemAccess& access) const override { access.emits<Hit, Noise>(); }
+		void update(float dt) override {
+			mRegistry.ctx<EventQueue<Hit>>().emit(10);
+			mRegistry.ctx<EventQueue<Noise>>().emit(1.f);
+		}
+	};
+
+	template<typename Event>
+	class Receiving : public system::System
+	{
+	public:
+		Receiving(entt::registry& registry, std::vector<size_t>* nrsOfEvents)
+			:System(registry)
+			,mNrsOfEvents(nrsOfEvents)
+		{
+		}
+		void declareAccess(SystemAccess& access) const override { access.receives<Event>(); }
+		void update(float dt) override { mNrsOfEvents->emplace_back(mRegistry.ctx<EventQueue<Event>>().size()); }
+
+	private:
+		std::vector<size_t>* mNrsOfEvents;
+	};
+
+	template<ActionId... Actions>
+	class ReceivingActions : public system::System
+	{
+	public:
+		ReceivingActions(entt::registry& registry, std::vector<ActionId>* receivedActions)
+			:System(registry)
+			,mReceivedActions(receivedActions)
+		{
+		}
+		void declareAccess(SystemAccess& access) const override { access.receivesActions<Actions...>(); }
+		void update(float dt) override {}
+		void onEvent(const ActionEvent& event) override { mReceivedActions->emplace_back(event.mAction); }
+
+	private:
+		std::vector<ActionId>* mReceivedActions;
+	};
+
+	std::vector<float> simulate(JobSystem* jobSystem)
+	{
+		entt::registry registry;
+		for(int i = 0; i < 100; ++i) {
+			auto entity = registry.create();
+			registry.assign<Position>(entity, static_cast<float>(i));
+			registry.assign<Speed>(entity, static_cast<float>(i % 7));
+			registry.assign<Distance>(entity, 0.f);
+		}
+
+		SystemsQueue queue(registry, jobSystem);
+		queue.appendSystem<Accelerate>();
+		queue.appendSystem<Move>();
+		queue.appendSystem<MeasureDistance>();
+		for(int frame = 0; frame < 50; ++frame)
+			queue.update(0.1f);
+
+		std::vector<float> distances;
+		registry.view<Distance>().each([&distances](const Distance& distance) { distances.emplace_back(distance.x); });
+		return distances;
+	}
+}
+
+TEST_CASE("Systems access conflicts", "[ECS][SystemsQueue]")
+{
+	SystemAccess readsPosition, writesPosition, writesSpeed, exclusive;
+	readsPosition.reads<Position>();
+	writesPosition.writes<Position>();
+	writesSpeed.writes<Speed>();
+	exclusive.runsExclusively();
+
+	CHECK_FALSE(readsPosition.conflictsWith(readsPosition));
+	CHECK(readsPosition.conflictsWith(writesPosition));
+	CHECK(writesPosition.conflictsWith(readsPosition));
+	CHECK(writesPosition.conflictsWith(writesPosition));
+	CHECK_FALSE(writesPosition.conflictsWith(writesSpeed));
+	CHECK(exclusive.conflictsWith(readsPosition));
+	CHECK(exclusive.mustRunOnMainThread());
+}
+
+TEST_CASE("Systems updated in parallel give the same results as updated sequentially", "[ECS][SystemsQueue]")
+{
+	JobSystem jobSystem(4);
+	CHECK(simulate(&jobSystem) == simulate(nullptr));
+}
+
+TEST_CASE("Conflicting systems are updated in the order in which they were appended", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	ExecutionLog log;
+	JobSystem jobSystem(4);
+	SystemsQueue queue(registry, &jobSystem);
+	for(int id = 0; id < 10; ++id)
+		queue.appendSystem<Logging>(&log, id);
+	queue.appendSystem<MainThreadOnly>(&log);
+
+	for(int frame = 0; frame < 20; ++frame)
+	{
+		log.order.clear();
+		queue.update(0.016f);
+		CHECK(log.order == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+		CHECK(log.mainThreadSystemThread == std::this_thread::get_id());
+	}
+}
+
+TEST_CASE("Exception thrown by system is rethrown by SystemsQueue::update()", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	JobSystem jobSystem(2);
+	SystemsQueue queue(registry, &jobSystem);
+	queue.appendSystem<Accelerate>();
+	queue.appendSystem<Throwing>();
+
+	CHECK_THROWS_AS(queue.update(0.016f), std::runtime_error);
+	CHECK_THROWS_AS(queue.update(0.016f), std::runtime_error);
+}
+
+TEST_CASE("Fixed step systems are updated with fixed time step", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	std::vector<float> fixedSteps, frames;
+	SystemsQueue queue(registry, nullptr);
+	queue.setFixedTimeStep(0.1f);
+	queue.setMaxNrOfFixedStepsPerFrame(3);
+	queue.appendFixedStepSystem<TimeStepLogging>(&fixedSteps);
+	queue.appendSystem<TimeStepLogging>(&frames);
+
+	SECTION("time which is left is carried to the next frame") {
+		queue.update(0.25f);
+		CHECK(fixedSteps == std::vector<float>{0.1f, 0.1f});
+		CHECK(frames == std::vector<float>{0.25f});
+		CHECK(registry.ctx<FixedStepInterpolation>().factor == Approx(0.5f));
+
+		queue.update(0.06f);
+		CHECK(fixedSteps.size() == 3);
+		CHECK(registry.ctx<FixedStepInterpolation>().factor == Approx(0.1f).margin(0.001f));
+	}
+	SECTION("frame time above the limit of steps is dropped") {
+		queue.update(1.f);
+		CHECK(fixedSteps.size() == 3);
+		queue.update(0.f);
+		CHECK(fixedSteps.size() == 3);
+	}
+}
+
+TEST_CASE("Systems with update interval get time of skipped updates and are spread across updates", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	std::vector<float> everyUpdate, first, second, third;
+	JobSystem jobSystem(2);
+	SystemsQueue queue(registry, &jobSystem);
+	queue.appendSystem<TimeStepLogging>(&everyUpdate);
+	queue.appendSystem<IntervalLogging<1>>(&first);
+	queue.appendSystem<IntervalLogging<2>>(&second);
+	queue.appendSystem<IntervalLogging<3>>(&third);
+	queue.setUpdateInterval<IntervalLogging<1>>(3);
+	queue.setUpdateInterval<IntervalLogging<2>>(3);
+	queue.setUpdateInterval<IntervalLogging<3>>(3);
+
+	for(int frame = 0; frame < 9; ++frame)
+	{
+		const size_t nrOfUpdatesBefore = first.size() + second.size() + third.size();
+		queue.update(0.1f);
+		CHECK(first.size() + second.size() + third.size() == nrOfUpdatesBefore + 1);
+	}
+
+	CHECK(everyUpdate.size() == 9);
+	for(auto* updates : {&first, &second, &third}) {
+		REQUIRE(updates->size() == 3);
+		CHECK(updates->back() == Approx(0.3f));
+	}
+}
+
+TEST_CASE("Events are received once and cleared after the last stage which receives them", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	std::vector<size_t> receivedHits, receivedNoisesInFixedSteps, receivedNoisesInFrames;
+	JobSystem jobSystem(2);
+	SystemsQueue queue(registry, &jobSystem);
+	queue.setFixedTimeStep(0.1f);
+	queue.appendFixedStepSystem<Emitting>();
+	queue.appendFixedStepSystem<Receiving<Hit>>(&receivedHits);
+	queue.appendFixedStepSystem<Receiving<Noise>>(&receivedNoisesInFixedSteps);
+	queue.appendSystem<Receiving<Noise>>(&receivedNoisesInFrames);
+
+	queue.update(0.35f);
+	CHECK(receivedHits == std::vector<size_t>{1, 1, 1});
+	CHECK(receivedNoisesInFixedSteps == std::vector<size_t>{1, 2, 3});
+	CHECK(receivedNoisesInFrames == std::vector<size_t>{3});
+	CHECK(registry.ctx<EventQueue<Hit>>().empty());
+	CHECK(registry.ctx<EventQueue<Noise>>().empty());
+}
+
+TEST_CASE("Action events are given only to systems which receive their actions", "[ECS][SystemsQueue]")
+{
+	entt::registry registry;
+	std::vector<ActionId> attacks, uses;
+	SystemsQueue queue(registry, nullptr);
+	queue.appendFixedStepSystem<ReceivingActions<ActionId::GunAttack, ActionId::MeleeAttack>>(&attacks);
+	queue.appendSystem<ReceivingActions<ActionId::Use>>(&uses);
+
+	queue.handleEvents(ActionEvent(ActionId::MeleeAttack, ActionEvent::Pressed));
+	queue.handleEvents(ActionEvent(ActionId::PauseScreen, ActionEvent::Pressed));
+	queue.handleEvents(ActionEvent(ActionId::Use, ActionEvent::Released));
+	queue.handleEvents(ActionEvent(ActionId::GunAttack, ActionEvent::Pressed));
+
+	CHECK(attacks == std::vector<ActionId>{ActionId::MeleeAttack, ActionId::GunAttack});
+	CHECK(uses == std::vector<ActionId>{ActionId::Use});
+}
+
+}
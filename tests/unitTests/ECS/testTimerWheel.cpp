@@ -0,0 +1,112 @@
+#include <catch.hpp>
+
+#include "ECS/timerWheel.hpp"
+#include <vector>
+
+namespace ph {
+
+namespace {
+	struct FiringLog
+	{
+		std::vector<std::pair<entt::entity, float>> firedTimers;
+		unsigned nrOfSteps = 0;
+		float time = 0.f;
+	};
+
+	struct Ring
+	{
+		entt::entity entity;
+	};
+
+	void logFiring(entt::registry& registry, entt::entity entity)
+	{
+		auto& log = registry.ctx<FiringLog>();
+		log.firedTimers.emplace_back(entity, log.time);
+	}
+
+	void repeatEverySecond(entt::registry& registry, entt::entity entity)
+	{
+		logFiring(registry, entity);
+		registry.ctx<TimerWheel>().schedule(entity, 1.f, &repeatEverySecond);
+	}
+
+	void advanceInSteps(entt::registry& registry, float seconds)
+	{
+		auto& timers = registry.ctx<TimerWheel>();
+		auto& log = registry.ctx<FiringLog>();
+		const unsigned nrOfSteps = static_cast<unsigned>(seconds / timers.getTickTime() + 0.5f);
+		for(unsigned step = 0; step < nrOfSteps; ++step) {
+			log.time = ++log.nrOfSteps * timers.getTickTime();
+			timers.advance(timers.getTickTime(), registry);
+		}
+	}
+}
+
+TEST_CASE("Timers fire once at their time, also the ones from higher levels of the wheel", "[ECS][TimerWheel]")
+{
+	entt::registry registry;
+	registry.set<TimerWheel>(0.1f);
+	auto& log = registry.set<FiringLog>();
+	auto soon = registry.create(), inMinute = registry.create(), inHour = registry.create();
+
+	auto& timers = registry.ctx<TimerWheel>();
+	timers.schedule(inHour, 3600.f, &logFiring);
+	timers.schedule(soon, 0.5f, &logFiring);
+	timers.schedule(inMinute, 60.f, &logFiring);
+	REQUIRE(timers.getNrOfPendingTimers() == 3);
+
+	advanceInSteps(registry, 59.f);
+	REQUIRE(log.firedTimers.size() == 1);
+	CHECK(log.firedTimers[0].first == soon);
+	CHECK(log.firedTimers[0].second == Approx(0.5f));
+
+	advanceInSteps(registry, 3600.f);
+	REQUIRE(log.firedTimers.size() == 3);
+	CHECK(log.firedTimers[1].first == inMinute);
+	CHECK(log.firedTimers[1].second == Approx(60.f));
+	CHECK(log.firedTimers[2].first == inHour);
+	CHECK(log.firedTimers[2].second == Approx(3600.f));
+	CHECK(timers.getNrOfPendingTimers() == 0);
+}
+
+TEST_CASE("Timers of destroyed and canceled entities don't fire", "[ECS][TimerWheel]")
+{
+	entt::registry registry;
+	registry.set<TimerWheel>(0.1f);
+	auto& log = registry.set<FiringLog>();
+	auto destroyed = registry.create(), canceled = registry.create(), rescheduled = registry.create();
+
+	auto& timers = registry.ctx<TimerWheel>();
+	timers.schedule(destroyed, 1.f, &logFiring);
+	timers.schedule(canceled, 1.f, &logFiring);
+	timers.schedule(rescheduled, 1.f, &logFiring);
+	registry.destroy(destroyed);
+	timers.cancel(canceled);
+	timers.cancel(rescheduled);
+	timers.schedule(rescheduled, 2.f, &logFiring);
+
+	advanceInSteps(registry, 3.f);
+	REQUIRE(log.firedTimers.size() == 1);
+	CHECK(log.firedTimers[0].first == rescheduled);
+	CHECK(log.firedTimers[0].second == Approx(2.f));
+}
+
+TEST_CASE("Timer callbacks can schedule timers and send events", "[ECS][TimerWheel]")
+{
+	entt::registry registry;
+	registry.set<TimerWheel>(0.1f);
+	auto& log = registry.set<FiringLog>();
+	auto& rings = registry.set<EventQueue<Ring>>();
+	auto repeating = registry.create(), ringing = registry.create();
+
+	auto& timers = registry.ctx<TimerWheel>();
+	timers.schedule(repeating, 1.f, &repeatEverySecond);
+	timers.scheduleEvent<Ring>(ringing, 2.f);
+
+	advanceInSteps(registry, 3.5f);
+	CHECK(log.firedTimers.size() == 3);
+	REQUIRE(rings.size() == 1);
+	CHECK(rings.begin()->entity == ringing);
+}
+
+}
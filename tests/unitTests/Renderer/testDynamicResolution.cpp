@@ -0,0 +1,74 @@
+#include <catch.hpp>
+
+#include "Renderer/dynamicResolution.hpp"
+
+namespace ph {
+
+static void simulateFrames(DynamicResolutionController& controller, float frameTime, unsigned nrOfFrames)
+{
+	for(unsigned i = 0; i < nrOfFrames; ++i)
+		controller.update(frameTime);
+}
+
+TEST_CASE("Dynamic resolution starts at full scale", "[Renderer][DynamicResolution]")
+{
+	DynamicResolutionController controller;
+	CHECK(controller.getScale() == Approx(1.f));
+}
+
+TEST_CASE("Dynamic resolution lowers scale when frames are too slow", "[Renderer][DynamicResolution]")
+{
+	DynamicResolutionController controller;
+
+	SECTION("scale goes down") {
+		simulateFrames(controller, 30.f, 15);
+		CHECK(controller.getScale() < 1.f);
+	}
+	SECTION("scale doesn't go below min scale") {
+		simulateFrames(controller, 100.f, 990);
+		CHECK(controller.getScale() == Approx(controller.getSettings().minScale));
+	}
+	SECTION("single spike doesn't change scale") {
+		simulateFrames(controller, 16.f, 14);
+		controller.update(40.f);
+		CHECK(controller.getScale() == Approx(1.f));
+	}
+}
+
+TEST_CASE("Dynamic resolution raises scale when there is headroom", "[Renderer][DynamicResolution]")
+{
+	DynamicResolutionController controller;
+	simulateFrames(controller, 100.f, 990);
+	const float loweredScale = controller.getScale();
+
+	simulateFrames(controller, 5.f, 15);
+	CHECK(controller.getScale() == Approx(loweredScale + controller.getSettings().scaleStep));
+
+	simulateFrames(controller, 5.f, 990);
+	CHECK(controller.getScale() == Approx(controller.getSettings().maxScale));
+}
+
+TEST_CASE("Dynamic resolution keeps scale while frame time is near the target", "[Renderer][DynamicResolution]")
+{
+	DynamicResolutionController controller;
+	simulateFrames(controller, 100.f, 990);
+	simulateFrames(controller, 15.f, 990);
+	CHECK(controller.getScale() == Approx(controller.getSettings().minScale));
+}
+
+TEST_CASE("Inactive dynamic resolution uses max scale", "[Renderer][DynamicResolution]")
+{
+	DynamicResolutionController controller;
+	simulateFrames(controller, 100.f, 990);
+
+	DynamicResolutionSettings settings;
+	settings.isActive = false;
+	settings.maxScale = 0.8f;
+	controller.setSettings(settings);
+	CHECK(controller.getScale() == Approx(0.8f));
+
+	simulateFrames(controller, 100.f, 990);
+	CHECK(controller.getScale() == Approx(0.8f));
+}
+
+}
@@ -0,0 +1,54 @@
+#include <catch.hpp>
+
+#include "Renderer/MinorRenderers/quadRenderer.hpp"
+#include "Renderer/API/nullRenderingBackend.hpp"
+#include "Renderer/API/texture.hpp"
+
+namespace ph {
+
+TEST_CASE("QuadRenderer batches quads without OpenGL context", "[Renderer][QuadRenderer]")
+{
+	NullRenderingBackend backend;
+	RenderingBackend::setCurrent(&backend);
+	{
+		const FloatRect screenBounds(0.f, 0.f, 640.f, 360.f);
+		QuadRenderer quadRenderer;
+		quadRenderer.init();
+		quadRenderer.setScreenBoundsPtr(&screenBounds);
+		Texture textureA, textureB;
+		backend.clearRecordedCalls();
+
+		SECTION("quads with the same shader and z are drawn with one draw call") {
+			for(int i = 0; i < 10; ++i) {
+				quadRenderer.submitQuad(&textureA, nullptr, nullptr, nullptr, {i * 10.f, 0.f}, {5.f, 5.f}, 0.5f, 0.f, {});
+				quadRenderer.submitQuad(&textureB, nullptr, nullptr, nullptr, {i * 10.f, 10.f}, {5.f, 5.f}, 0.5f, 0.f, {});
+			}
+			quadRenderer.flush();
+
+			auto& recorded = backend.getRecordedCalls();
+			CHECK(recorded.drawCalls == 1);
+			CHECK(recorded.drawnInstances == 20);
+			CHECK(recorded.uploadedBytes == 20 * sizeof(QuadData));
+			CHECK(recorded.textureBinds == 2);
+		}
+		SECTION("quads with different z are drawn with separate draw calls") {
+			quadRenderer.submitQuad(&textureA, nullptr, nullptr, nullptr, {0.f, 0.f}, {5.f, 5.f}, 0.5f, 0.f, {});
+			quadRenderer.submitQuad(&textureA, nullptr, nullptr, nullptr, {0.f, 0.f}, {5.f, 5.f}, 0.6f, 0.f, {});
+			quadRenderer.flush();
+
+			CHECK(backend.getRecordedCalls().drawCalls == 2);
+		}
+		SECTION("quads outside of the screen are not drawn") {
+			quadRenderer.submitQuad(&textureA, nullptr, nullptr, nullptr, {10.f, 10.f}, {5.f, 5.f}, 0.5f, 0.f, {});
+			quadRenderer.submitQuad(&textureA, nullptr, nullptr, nullptr, {1000.f, 10.f}, {5.f, 5.f}, 0.5f, 0.f, {});
+			quadRenderer.flush();
+
+			CHECK(backend.getRecordedCalls().drawnInstances == 1);
+		}
+
+		quadRenderer.shutDown();
+	}
+	RenderingBackend::setCurrent(nullptr);
+}
+
+}
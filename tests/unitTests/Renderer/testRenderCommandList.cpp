@@ -0,0 +1,86 @@
+#include <catch.hpp>
+
+#include "Renderer/renderCommandList.hpp"
+
+namespace ph {
+
+static RenderCommandList makeProducerList(float offset)
+{
+	RenderCommandList list;
+	list.points.emplace_back(SubmitPointCommand{sf::Color::Red, {offset, 5.f}, 2.f, 10});
+	list.lines.emplace_back(SubmitLineCommand{sf::Color::Red, sf::Color::Blue, {offset, 0.f}, {0.f, offset}, 1.f});
+	list.lightBlockingQuads.emplace_back(SubmitLightBlockingQuadCommand{{offset, 0.f}, {16.f, 16.f}});
+	list.quadsOfBunches.resize(2);
+	list.quadsOfBunches[0].position = {offset, 0.f};
+	list.quads.emplace_back(SubmitBunchOfQuadsCommand{nullptr, nullptr, 0, 2, 50});
+	SubmitQuadCommand quad;
+	quad.texture = nullptr;
+	quad.shader = nullptr;
+	quad.position = {offset, offset};
+	quad.size = {10.f, 10.f};
+	quad.rotationOrigin = {};
+	quad.rotation = 0.f;
+	quad.z = 100;
+	list.quads.emplace_back(quad);
+	return list;
+}
+
+TEST_CASE("Appended bunches of quads point to copied quads data", "[Renderer][RenderCommandList]")
+{
+	RenderCommandList frame = makeProducerList(1.f);
+	frame.append(makeProducerList(2.f));
+
+	REQUIRE(frame.quads.size() == 4);
+	REQUIRE(frame.quadsOfBunches.size() == 4);
+	auto& appendedBunch = std::get<SubmitBunchOfQuadsCommand>(frame.quads[2]);
+	CHECK(appendedBunch.firstQuadIndex == 2);
+	CHECK(frame.quadsOfBunches[appendedBunch.firstQuadIndex].position.x == 2.f);
+}
+
+TEST_CASE("Merging producer lists doesn't depend on the order of producers", "[Renderer][RenderCommandList]")
+{
+	RenderCommandList first, second;
+	RenderCommandList a = makeProducerList(1.f), b = makeProducerList(2.f), c = makeProducerList(3.f);
+
+	auto merge = [](RenderCommandList& target, std::vector<const RenderCommandList*> producers) {
+		const auto marker = target.getMarker();
+		for(auto* producer : producers)
+			target.append(*producer);
+		target.sortBySortKey(marker);
+	};
+	merge(first, {&a, &b, &c});
+	merge(second, {&c, &a, &b});
+
+	REQUIRE(first.points.size() == second.points.size());
+	for(size_t i = 0; i < first.points.size(); ++i)
+		CHECK(first.points[i].position == second.points[i].position);
+	for(size_t i = 0; i < first.lines.size(); ++i)
+		CHECK(first.lines[i].positionA == second.lines[i].positionA);
+	for(size_t i = 0; i < first.lightBlockingQuads.size(); ++i)
+		CHECK(first.lightBlockingQuads[i].position == second.lightBlockingQuads[i].position);
+
+	REQUIRE(first.quads.size() == second.quads.size());
+	for(size_t i = 0; i < first.quads.size(); ++i)
+	{
+		REQUIRE(first.quads[i].index() == second.quads[i].index());
+		if(auto* quad = std::get_if<SubmitQuadCommand>(&first.quads[i]))
+			CHECK(quad->position == std::get<SubmitQuadCommand>(second.quads[i]).position);
+		else
+			CHECK(first.quadsOfBunches[std::get<SubmitBunchOfQuadsCommand>(first.quads[i]).firstQuadIndex].position ==
+			      second.quadsOfBunches[std::get<SubmitBunchOfQuadsCommand>(second.quads[i]).firstQuadIndex].position);
+	}
+}
+
+TEST_CASE("Sorting leaves commands recorded before the marker untouched", "[Renderer][RenderCommandList]")
+{
+	RenderCommandList frame;
+	frame.points.emplace_back(SubmitPointCommand{sf::Color::Red, {100.f, 100.f}, 1.f, 0});
+	const auto marker = frame.getMarker();
+	frame.append(makeProducerList(1.f));
+	frame.sortBySortKey(marker);
+
+	REQUIRE(frame.points.size() == 2);
+	CHECK(frame.points[0].position == sf::Vector2f(100.f, 100.f));
+}
+
+}
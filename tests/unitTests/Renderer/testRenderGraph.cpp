@@ -0,0 +1,79 @@
+#include <catch.hpp>
+
+#include "Renderer/renderGraph.hpp"
+#include "Renderer/API/framebuffer.hpp"
+
+namespace ph {
+
+static auto doNothing = [](const RenderPassContext&) {};
+
+TEST_CASE("Render graph fuses pass into consumer which accepts it", "[Renderer][RenderGraph]")
+{
+	Framebuffer gameObjects;
+	RenderGraph graph;
+	graph.importFramebuffer("gameObjects", &gameObjects);
+	graph.addPass({"lighting", {}, "lighting", doNothing});
+	RenderPass blur{"blur", {{"lighting"}}, "blurredLighting", doNothing};
+	blur.canBeFusedIntoConsumer = true;
+	graph.addPass(blur);
+
+	SECTION("consumer accepts fused pass") {
+		graph.addPass({"composition", {{"gameObjects"}, {"blurredLighting", true}}, "", doNothing});
+		graph.compile();
+		CHECK(graph.isPassFused("blur"));
+		CHECK_FALSE(graph.isPassExecuted("blur"));
+		CHECK(graph.getNumberOfExecutedPasses() == 2);
+		CHECK(graph.getMaxNumberOfTransientResourcesAlive() == 1);
+	}
+	SECTION("fusion is disabled") {
+		graph.addPass({"composition", {{"gameObjects"}, {"blurredLighting", true}}, "", doNothing});
+		graph.compile(false);
+		CHECK_FALSE(graph.isPassFused("blur"));
+		CHECK(graph.getNumberOfExecutedPasses() == 3);
+		CHECK(graph.getMaxNumberOfTransientResourcesAlive() == 2);
+	}
+	SECTION("consumer doesn't accept fused pass") {
+		graph.addPass({"composition", {{"gameObjects"}, {"blurredLighting"}}, "", doNothing});
+		graph.compile();
+		CHECK_FALSE(graph.isPassFused("blur"));
+		CHECK(graph.isPassExecuted("blur"));
+	}
+	SECTION("output of pass has more than one reader") {
+		graph.addPass({"bloom", {{"blurredLighting"}}, "bloom", doNothing});
+		graph.addPass({"composition", {{"bloom"}, {"blurredLighting", true}}, "", doNothing});
+		graph.compile();
+		CHECK_FALSE(graph.isPassFused("blur"));
+		CHECK(graph.isPassExecuted("blur"));
+	}
+}
+
+TEST_CASE("Render graph skips passes whose output isn't read", "[Renderer][RenderGraph]")
+{
+	RenderGraph graph;
+	graph.addPass({"lighting", {}, "lighting", doNothing});
+	graph.addPass({"unusedBlur", {{"lighting"}}, "unusedBlurredLighting", doNothing});
+	graph.addPass({"unusedBlurOfBlur", {{"unusedBlurredLighting"}}, "unusedBlurredTwice", doNothing});
+	graph.addPass({"composition", {{"lighting"}}, "", doNothing});
+	graph.compile();
+
+	CHECK(graph.isPassExecuted("lighting"));
+	CHECK_FALSE(graph.isPassExecuted("unusedBlur"));
+	CHECK_FALSE(graph.isPassExecuted("unusedBlurOfBlur"));
+	CHECK(graph.isPassExecuted("composition"));
+}
+
+TEST_CASE("Render graph reuses transient framebuffers after their last reader", "[Renderer][RenderGraph]")
+{
+	RenderGraph graph;
+	graph.addPass({"a", {}, "a", doNothing});
+	graph.addPass({"b", {{"a"}}, "b", doNothing});
+	graph.addPass({"c", {{"b"}}, "c", doNothing});
+	graph.addPass({"d", {{"c"}}, "d", doNothing});
+	graph.addPass({"composition", {{"d"}}, "", doNothing});
+	graph.compile();
+
+	// chain of passes never needs more than input and output at the same time
+	CHECK(graph.getMaxNumberOfTransientResourcesAlive() == 2);
+}
+
+}
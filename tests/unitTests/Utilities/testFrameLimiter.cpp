@@ -0,0 +1,37 @@
+#include "catch.hpp"
+
+#include "Utilities/frameLimiter.hpp"
+#include <chrono>
+
+namespace ph {
+
+namespace {
+	double measureSecondsOfFrames(FrameLimiter& frameLimiter, int nrOfFrames, bool isInBackground)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < nrOfFrames; ++i)
+			frameLimiter.waitForNextFrame(isInBackground);
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+TEST_CASE("Frame limiter keeps frame rate below the limit", "[Utilities][FrameLimiter]")
+{
+	FrameLimiter frameLimiter;
+
+	SECTION("frame rate isn't limited by default") {
+		CHECK(measureSecondsOfFrames(frameLimiter, 100, false) < 0.05);
+	}
+	SECTION("limited frame rate") {
+		frameLimiter.setMaxFrameRate(200);
+		frameLimiter.waitForNextFrame(false);
+		CHECK(measureSecondsOfFrames(frameLimiter, 20, false) >= 0.095);
+	}
+	SECTION("background frame rate") {
+		frameLimiter.setBackgroundFrameRate(50);
+		frameLimiter.waitForNextFrame(true);
+		CHECK(measureSecondsOfFrames(frameLimiter, 5, true) >= 0.095);
+	}
+}
+
+}
@@ -0,0 +1,43 @@
+#include <catch.hpp>
+
+#include "Utilities/rectsMerging.hpp"
+#include <algorithm>
+
+namespace ph {
+
+TEST_CASE("Grid of tiles is merged into one rect", "[Utilities][RectsMerging]")
+{
+	std::vector<FloatRect> rects;
+	for(float y = 0.f; y < 3.f; ++y)
+		for(float x = 0.f; x < 4.f; ++x)
+			rects.emplace_back(x * 16.f, y * 16.f, 16.f, 16.f);
+
+	mergeAdjacentRects(rects);
+
+	REQUIRE(rects.size() == 1);
+	CHECK(rects[0] == FloatRect(0.f, 0.f, 64.f, 48.f));
+}
+
+TEST_CASE("Rects of different shapes are merged without changing covered area", "[Utilities][RectsMerging]")
+{
+	SECTION("L shape becomes two rects") {
+		std::vector<FloatRect> rects{{0.f, 0.f, 16.f, 16.f}, {16.f, 0.f, 16.f, 16.f}, {0.f, 16.f, 16.f, 16.f}};
+		mergeAdjacentRects(rects);
+		REQUIRE(rects.size() == 2);
+		CHECK(std::find(rects.begin(), rects.end(), FloatRect(0.f, 0.f, 32.f, 16.f)) != rects.end());
+		CHECK(std::find(rects.begin(), rects.end(), FloatRect(0.f, 16.f, 16.f, 16.f)) != rects.end());
+	}
+	SECTION("Rects which don't touch stay separate") {
+		std::vector<FloatRect> rects{{0.f, 0.f, 16.f, 16.f}, {20.f, 0.f, 16.f, 16.f}};
+		mergeAdjacentRects(rects);
+		REQUIRE(rects.size() == 2);
+	}
+	SECTION("Overlapping rects in the same row become one") {
+		std::vector<FloatRect> rects{{10.f, 5.f, 20.f, 4.f}, {0.f, 5.f, 15.f, 4.f}};
+		mergeAdjacentRects(rects);
+		REQUIRE(rects.size() == 1);
+		CHECK(rects[0] == FloatRect(0.f, 5.f, 30.f, 4.f));
+	}
+}
+
+}
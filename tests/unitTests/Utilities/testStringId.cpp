@@ -0,0 +1,39 @@
+#include "catch.hpp"
+
+#include "Utilities/stringId.hpp"
+#include <unordered_map>
+
+namespace ph {
+
+TEST_CASE("StringIds of the same strings are equal", "[Utilities][StringId]")
+{
+	constexpr StringId literalId("zombie");
+	static_assert(literalId == StringId("zombie"));
+	static_assert(literalId != StringId("zombies"));
+	static_assert(StringId() == StringId(""));
+
+	const std::string string = "zombie";
+	CHECK(StringId(string) == literalId);
+	CHECK(StringId(std::string_view(string)) == literalId);
+	CHECK(StringId("sounds/zombieGrowl.ogg") != StringId("sounds/zombieGrowl2.ogg"));
+}
+
+TEST_CASE("Interned StringId can be turned back to string", "[Utilities][StringId]")
+{
+	const StringId interned = StringId::intern(std::string("sounds/barretaShot.wav"));
+	CHECK(interned == StringId("sounds/barretaShot.wav"));
+	CHECK(std::string(interned.getString()) == "sounds/barretaShot.wav");
+	CHECK(std::string(StringId("never interned").getString()) == "<not interned>");
+}
+
+TEST_CASE("StringId can be used as key of unordered map", "[Utilities][StringId]")
+{
+	std::unordered_map<StringId, int> map;
+	map["up"] = 1;
+	map[StringId::intern("down")] = 2;
+	CHECK(map.at("up") == 1);
+	CHECK(map.at(std::string("down")) == 2);
+	CHECK(map.find("left") == map.end());
+}
+
+}
@@ -137,7 +137,8 @@ project "Tests"
     }
     
     removefiles{
-        root_dir .. "src/main.cpp"
+        root_dir .. "src/main.cpp",
+        root_dir .. "tests/benchmarks/**"
     }
 
     links{
@@ -190,6 +191,85 @@ project "Tests"
         defines{"PH_MAC"}
 
     filter{}
+
+project "Benchmarks"
+    location (root_dir)
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+
+    targetdir (exe_dir)
+	objdir (obj_dir)
+    
+    debugdir "%{wks.location}"
+    
+    includedirs{
+        root_dir .. "src",
+        root_dir .. "vendor/SFML_2.5.1/include",
+		root_dir .. "vendor/glew-2.1.0/include",
+		root_dir .. "vendor/stb",
+        root_dir .. "vendor/entt-3.2.0/src"
+    }
+
+    libdirs{
+		root_dir .. "vendor/SFML_2.5.1/lib-VisualStudio",
+		root_dir .. "vendor/glew-2.1.0/lib"
+	}
+
+    files{
+        root_dir .. "src/**.hpp",
+        root_dir .. "src/**.cpp",
+        root_dir .. "src/**.inl",
+        root_dir .. "tests/benchmarks/**.hpp",
+        root_dir .. "tests/benchmarks/**.cpp"
+    }
+    
+    removefiles{
+        root_dir .. "src/main.cpp"
+    }
+
+    links{
+        "opengl32.lib",
+        "winmm.lib",
+        "gdi32.lib",
+        "freetype.lib",
+        "flac.lib",
+        "vorbisenc.lib",
+        "vorbisfile.lib",
+        "vorbis.lib",
+        "ogg.lib",
+        "openal32.lib",
+		"glew32s.lib"
+    }
+
+	ignoredefaultlibraries { "libcmt" }
+
+    defines{
+		"SFML_STATIC",
+		"GLEW_STATIC"
+	}
+
+    -- benchmarks are meaningful only with optimizations turned on
+    optimize "On"
+
+    links{
+        "sfml-graphics-s",
+        "sfml-audio-s", 
+        "sfml-network-s",
+        "sfml-window-s",
+        "sfml-system-s"
+    }
+
+    filter "system:Windows"
+        defines{"PH_WINDOWS"}
+
+    filter "system:Unix"
+        defines{"PH_LINUX"}
+
+    filter "system:Mac"
+        defines{"PH_MAC"}
+
+    filter{}
     
 printf("For now PopHead supports only new Visual Studio versions and Codeblocks.")
 printf("If you have any problems with Premake or compiling PopHead contact Grzegorz \"Czapa\" Bednorz.")
\ No newline at end of file